@@ -1,8 +1,22 @@
+#define _GNU_SOURCE
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <limits.h>
 #include <signal.h>
 #include <unistd.h>
+#include <time.h>
+#include <pthread.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <wordexp.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <sys/inotify.h>
+#include <poll.h>
+#include <libgen.h>
+#include <linux/io_uring.h>
 #include <sys/wait.h>
 #include <sys/types.h>
 
@@ -13,31 +27,261 @@ struct date
     int day;
 };
 
+//strings shorter than this are stored inside the task instead of in a stringPool
+#define SHORT_STRING_SIZE 24
+//marks a shortString as pooled, in the last byte (which is 0 for inline strings)
+#define SHORT_STRING_POOLED 1
+//size of each block of a stringPool
+#define STRING_POOL_BLOCK 4096
+
+//a string stored inline when short, or as a pointer into a stringPool when long
+struct shortString
+{
+    union
+    {
+        char inlineChars[SHORT_STRING_SIZE];
+        char* pooled;
+    };
+};
+
+//a block of memory that pooled strings are carved out of
+struct poolBlock
+{
+    struct poolBlock* next;
+    size_t size;
+    size_t used;
+    char data[];
+};
+
+//storage for strings too long to be stored inline, freed all at once
+struct stringPool
+{
+    struct poolBlock* blocks;
+};
+
 struct task
 {
     int complete;
-    char* name;
+    int followed; //1 if this task came from the followed import file
+    struct shortString name;
     struct date dueDate;
-    char* category;
+    int heapIndex; //position in the taskList's heap, or -1 if not scheduled
+    struct shortString category;
+    int priority; //due date in days, less the category's weight
     struct task* next;
 };
 
+//how many days earlier than their due date a category's tasks are scheduled
+struct categoryWeight
+{
+    char* category;
+    int days;
+};
+
+//the most days a category can be moved, which keeps priorities well within an int
+#define MAX_PRIORITY_DAYS 36500
+
+//priority of tasks whose due date isn't a real date, so they're scheduled after all others
+#define INVALID_DATE_PRIORITY INT_MAX
+
 struct taskList
 {
     struct task* head;
+    struct task* tail; //last task, so tasks can be appended without walking the list
+    int numTasks;
+
+    //every REPORT_SLICE_TASKS-th task, so reports can split the list across threads
+    struct task** slices;
+    int numSlices;
+    int sliceCapacity;
+
+    int incompleteTasks;
+    struct stringPool strings;
+    struct stringPool followedStrings; //long strings of tasks from the followed file, freed when it's reloaded
+
+    //binary min-heap of incomplete tasks by priority, most urgent first
+    struct task** heap;
+    int heapSize;
+    int heapCapacity;
+    struct categoryWeight* weights;
+    int numWeights;
+};
+
+//events on the followed file, and on its directory (to notice it being replaced)
+#define FOLLOW_FILE_EVENTS (IN_MODIFY | IN_ATTRIB | IN_MOVE_SELF | IN_DELETE_SELF)
+#define FOLLOW_DIR_EVENTS (IN_CREATE | IN_MOVED_TO | IN_CLOSE_WRITE)
+
+//how many of the bytes already read are compared to notice the file being rewritten in place
+#define FOLLOW_TAIL_SIZE 64
+
+//state for following the imported file while other tools add to it
+struct followState
+{
+    char* path; //NULL unless tasks were imported from a single file
+    int inotifyFd; //-1 while not following
+    int fileWatch;
+    int dirWatch;
+    dev_t device;
+    ino_t inode;
+    off_t offset; //bytes of the file already turned into tasks
+    char tail[FOLLOW_TAIL_SIZE]; //the last bytes before offset, to notice the file being rewritten
+    int tailLength; //-1 if the tail couldn't be read
+};
+
+//reads kept in flight at once when importing several files through io_uring
+#define IMPORT_RING_ENTRIES 64
+//threads reading files when io_uring is unavailable
+#define IMPORT_POOL_THREADS 8
+//largest single read of an import file
+#define IMPORT_MAX_READ (1 << 30)
+
+//one file of a multi-file import, and the tasks parsed from it
+struct importShard
+{
+    char* path;
+    int fd;
+    size_t size;
+    size_t bytesRead;
+    char* data;
+    struct task* head;
+    struct task* tail;
     int numTasks;
     int incompleteTasks;
+    struct stringPool strings;
+};
+
+//work shared by the import thread pool
+struct importPool
+{
+    struct importShard* shards;
+    int numShards;
+    int nextShard;
+    pthread_mutex_t lock;
+};
+
+//lists with fewer tasks than this are reported on a single thread
+#define REPORT_THREAD_THRESHOLD 100000
+#define REPORT_MAX_THREADS 16
+
+//report threads are given whole slices of this many tasks
+#define REPORT_SLICE_TASKS 4096
+
+//report output formats
+#define REPORT_TABLE 1
+#define REPORT_CSV 2
+#define REPORT_JSON 3
+
+//month key given to tasks whose due date isn't a real date. valid dates have
+//month keys of year * 12 + month - 1, which are never 0 as years start at 1
+#define REPORT_INVALID_MONTH 0
+
+//aggregate counts for one report group
+struct reportCounts
+{
+    int total;
+    int complete;
+    int overdue;
+};
+
+//counts for one due month or (category, month) pair. keys are category << 32 | month
+struct reportGroup
+{
+    long long key;
+    struct reportCounts counts;
+};
+
+//open addressing hash table of report groups. empty slots have a key of -1
+struct groupTable
+{
+    struct reportGroup* slots;
+    size_t capacity;
+    size_t count;
+};
+
+//grouped aggregates over a task list. categories are sorted by name, and months
+//and pairs are sorted by key, so pairs are in category then month order
+struct taskReport
+{
+    char** categories;
+    int numCategories;
+    struct reportCounts* categoryCounts;
+    struct reportGroup* months;
+    int numMonths;
+    struct reportGroup* pairs;
+    int numPairs;
+};
+
+//state for one report thread, covering count tasks starting at first
+struct reportWorker
+{
+    struct task* first;
+    int count;
+    struct date today;
+    int failed; //set if memory ran out
+
+    //categories seen by this thread, given ids in the order they're seen.
+    //categoryTable is a hash table of those ids, with -1 in empty slots
+    char** categories;
+    unsigned* categoryHashes;
+    struct reportCounts* categoryCounts;
+    int numCategories;
+    int categoryCapacity;
+    int* categoryTable;
+    int tableCapacity;
+
+    //(category, month) pair counts using this thread's category ids. month
+    //counts are summed from these when merging, so they aren't counted per task
+    struct groupTable pairs;
 };
 
 FILE* promptImport(char** buffer, size_t bufferSize, int retry);
-void importTasks(struct taskList* tasks, FILE* importFile);
-struct task* createTaskFromFile(char* currLine);
-void createDueDate(struct task* currTask, char* dueDate);
+off_t importTasks(struct taskList* tasks, FILE* importFile);
+int expandImportPaths(char* input, char*** paths);
+void parseImportShard(struct importShard* shard);
+void openImportShard(struct importShard* shard);
+int readShardsUring(struct importShard* shards, int numShards);
+void* importPoolWorker(void* arg);
+void importTaskFiles(struct taskList* tasks, char** paths, int numPaths);
+char* stringValue(struct shortString* str);
+void setString(struct shortString* str, char* value, struct stringPool* pool);
+char* poolAlloc(struct stringPool* pool, size_t size);
+void mergeStringPool(struct stringPool* pool, struct stringPool* from);
+void freeStringPool(struct stringPool* pool);
+struct task* createTaskFromFile(char* currLine, struct stringPool* pool);
+int createDueDate(struct task* currTask, char* dueDate);
 void viewTasks(struct taskList* tasks);
+int daysFromCivil(struct date dueDate);
+int taskPriority(struct taskList* tasks, struct task* currTask);
+void siftUp(struct taskList* tasks, int index);
+void siftDown(struct taskList* tasks, int index);
+void scheduleTask(struct taskList* tasks, struct task* currTask);
+void unscheduleTask(struct taskList* tasks, struct task* currTask);
+void rescheduleTask(struct taskList* tasks, struct task* currTask);
+void showNextTasks(struct taskList* tasks);
+void completeNextTask(struct taskList* tasks);
+void prioritizeCategory(struct taskList* tasks);
 void createTaskFromUser(struct taskList* tasks);
 void freeTaskList(struct taskList* tasks);
 void completeTask(struct taskList* tasks);
 void exportTasks(struct taskList* tasks);
+void indexTask(struct taskList* tasks, struct task* currTask, int position);
+int isValidDate(struct date dueDate);
+void* reportScanWorker(void* arg);
+int buildReport(struct taskList* tasks, struct taskReport* report);
+void printReport(struct taskReport* report, FILE* out, int format);
+void freeReport(struct taskReport* report);
+void reportTasks(struct taskList* tasks);
+void initFollow(struct followState* follow, char* path, FILE* importFile);
+void recordFollowTail(struct followState* follow);
+int readFollowTail(off_t offset, int fd, char* tail);
+int startFollow(struct followState* follow, struct taskList* tasks);
+void stopFollow(struct followState* follow);
+int syncFollow(struct followState* follow, struct taskList* tasks);
+int readFollowedTasks(struct taskList* tasks, int fd, off_t* offset);
+void removeFollowedTasks(struct taskList* tasks);
+void waitForInput(struct followState* follow, struct taskList* tasks);
+void drainFollowEvents(struct followState* follow);
+void toggleFollow(struct followState* follow, struct taskList* tasks);
 
 /**********************************************************************************
     ** Description: Prompt's user whether they would like to import tasks
@@ -55,7 +299,7 @@ FILE* promptImport(char** buffer, size_t bufferSize, int retry)
     //otherwise, prompt user to import tasks or start fresh
     else
     {
-        printf("|--------------------------------------------------\n|\n|   Task Manager: Welcome!\n|\n|   To begin, you have 2 options:\n|\n|   1. To start with no tasks/from scratch, simply\n|      hit enter. (This may be a better option for\n|      first-time users).\n|\n|      OR\n|\n|   2. To import tasks, type the name of a file\n|      from which to import tasks, and hit enter.\n|      (This requires you already have a premade\n|      file from which to import from).\n|\n|   To see how import files should be formatted,\n|   type 'help' and hit enter.\n|\n|   : ");
+        printf("|--------------------------------------------------\n|\n|   Task Manager: Welcome!\n|\n|   To begin, you have 2 options:\n|\n|   1. To start with no tasks/from scratch, simply\n|      hit enter. (This may be a better option for\n|      first-time users).\n|\n|      OR\n|\n|   2. To import tasks, type the name of a file\n|      from which to import tasks, and hit enter.\n|      (This requires you already have a premade\n|      file from which to import from).\n|\n|      To import several files at once, list\n|      them separated by spaces, or use a\n|      pattern such as teams/*.txt.\n|\n|   To see how import files should be formatted,\n|   type 'help' and hit enter.\n|\n|   : ");
     }
 
     //take in user input; getline can dynamically resize buffer
@@ -148,40 +392,50 @@ FILE* promptImport(char** buffer, size_t bufferSize, int retry)
 /**********************************************************************************
     ** Description: Imports tasks from a correctly formatted text file.
     ** Parameters: A premade taskList struct and the file to import from
+    ** Returns: The number of bytes read from the file, up to its last newline
 **********************************************************************************/
-void importTasks(struct taskList* tasks, FILE* importFile)
+off_t importTasks(struct taskList* tasks, FILE* importFile)
 {
     char *currLine = NULL;
     size_t len = 0;
     size_t charsRead = 0;
-
-    //create tail pointer to make insertions easier
-    struct task *tail = NULL;
+    off_t bytesRead = 0;
 
     //if getline() fails to read any characters from the input stream, it returns -1 (end of file)
     while ((charsRead = getline(&currLine, &len, importFile)) != -1){
 
-        tasks->numTasks++;
+        //a last line without a newline may still be being written, so it's left for following to read
+        if(currLine[charsRead - 1] != '\n'){
+            break;
+        }
+        bytesRead += charsRead;
 
-        //create a new task corresponding to the current line in file
-        struct task *newTask = createTaskFromFile(currLine);
+        //create a new task corresponding to the current line in file, skipping badly formatted lines
+        struct task *newTask = createTaskFromFile(currLine, &tasks->followedStrings);
+        if(newTask == NULL){
+            continue;
+        }
+        indexTask(tasks, newTask, tasks->numTasks);
+        tasks->numTasks++;
+        newTask->followed = 1;
         
-        //if this imported task is incomplete, increment incompleteTasks
+        //if this imported task is incomplete, increment incompleteTasks and schedule it
         if(newTask->complete == 0){
             tasks->incompleteTasks++;
+            scheduleTask(tasks, newTask);
         }
 
         //if list is empty
         if(tasks->head == NULL){
             //set the head and the tail to this new node
             tasks->head = newTask;
-            tail = newTask;
+            tasks->tail = newTask;
         }
         //else, list is populated
         else{
             //add new node to the list and advance the tail
-            tail->next = newTask;
-            tail = newTask;
+            tasks->tail->next = newTask;
+            tasks->tail = newTask;
         }
     }
 
@@ -192,442 +446,2637 @@ void importTasks(struct taskList* tasks, FILE* importFile)
     //free buffer and file
     free(currLine);
     fclose(importFile);
+    return bytesRead;
 }
 
 /**********************************************************************************
-    ** Description: Takes in a line from a file and creates a task struct from it.
-    ** Parameters: The current line corresponding to a task in the file.
+    ** Description: Expands a list of file names and/or glob patterns (separated
+    by spaces, e.g. "team1.txt team*.txt") into the files to import. Globs
+    expand in sorted order, so the files are imported in a defined order.
+    ** Parameters: The user's input, and where to store the allocated list of paths
+    ** Returns: The number of paths, or 0 if any of them can't be read
 **********************************************************************************/
-struct task* createTaskFromFile(char* currLine){
-    //malloc new task object
-    struct task* currTask = malloc(sizeof(struct task));
-
-    //for use with strtok_r. see https://man7.org/linux/man-pages/man3/strtok_r.3.html
-    char *saveptr;
-    const char *delim = "|";
-    
-    //complete bool
-    char *token = strtok_r(currLine, delim, &saveptr);
-    currTask->complete = atoi(token);
-
-    //task name
-    token = strtok_r(NULL, delim, &saveptr);
-    currTask->name = calloc(strlen(token) + 1, sizeof(char));
-    strcpy(currTask->name, token);
-
-    //task due date
-    token = strtok_r(NULL, delim, &saveptr);
-    createDueDate(currTask, token);
-
-    //task category
-    token = strtok_r(NULL, "\n", &saveptr);
-    currTask->category = calloc(strlen(token) + 1, sizeof(char));
-    strcpy(currTask->category, token);
+int expandImportPaths(char* input, char*** paths)
+{
+    wordexp_t words;
+    if(wordexp(input, &words, WRDE_NOCMD) != 0)
+    {
+        return 0;
+    }
 
-    //set task node's next to null
-    currTask->next = NULL;
+    //unmatched globs are left as-is by wordexp, so check every path can be read
+    for(size_t i = 0; i < words.we_wordc; i++)
+    {
+        if(access(words.we_wordv[i], R_OK) != 0)
+        {
+            wordfree(&words);
+            return 0;
+        }
+    }
 
-    return currTask;
+    int numPaths = words.we_wordc;
+    *paths = malloc(numPaths * sizeof(char*));
+    for(int i = 0; i < numPaths; i++)
+    {
+        (*paths)[i] = strdup(words.we_wordv[i]);
+    }
+    wordfree(&words);
+    return numPaths;
 }
 
 /**********************************************************************************
-    ** Description: Creates a due date struct from a string when importing tasks.
-    ** Parameters: The current task corresponding to due date, and the string
-    of the due date of the form YYY_MM_DD.
+    ** Description: Parses a shard's fully read contents into its own task list.
+    The contents are freed afterwards, as every task copies its strings.
+    ** Parameters: The shard whose data to parse
 **********************************************************************************/
-void createDueDate(struct task* currTask, char* dueDate){
-    //dueDate takes the form of YYYY_MM_DD
-
-    char* token;
-    char* saveptr;
-    const char* delim = "_";
+void parseImportShard(struct importShard* shard)
+{
+    char* currLine = shard->data;
+    char* end = shard->data + shard->bytesRead;
+    *end = '\0';
 
-    //year
-    token = strtok_r(dueDate, delim, &saveptr);
-    currTask->dueDate.year = atoi(token);
+    while(currLine < end)
+    {
+        //cut the line off at its newline, if it has one
+        char* newline = memchr(currLine, '\n', end - currLine);
+        char* nextLine = end;
+        if(newline != NULL)
+        {
+            *newline = '\0';
+            nextLine = newline + 1;
+        }
 
-    //month
-    token = strtok_r(NULL, delim, &saveptr);
-    currTask->dueDate.month = atoi(token);
+        //skip blank lines, such as a trailing empty line
+        if(currLine[0] != '\0')
+        {
+            //badly formatted lines are skipped
+            struct task* newTask = createTaskFromFile(currLine, &shard->strings);
+            if(newTask != NULL)
+            {
+                shard->numTasks++;
+                if(newTask->complete == 0)
+                {
+                    shard->incompleteTasks++;
+                }
+
+                if(shard->head == NULL)
+                {
+                    shard->head = newTask;
+                }
+                else
+                {
+                    shard->tail->next = newTask;
+                }
+                shard->tail = newTask;
+            }
+        }
+        currLine = nextLine;
+    }
 
-    //day
-    token = strtok_r(NULL, delim, &saveptr);
-    currTask->dueDate.day = atoi(token);
+    free(shard->data);
+    shard->data = NULL;
 }
 
 /**********************************************************************************
-    ** Description: Prints a task list
-    ** Parameters: Task list struct to be printed
+    ** Description: Opens a shard's file and allocates a buffer for its contents.
+    ** Parameters: The shard to open
 **********************************************************************************/
-void viewTasks(struct taskList* tasks)
+void openImportShard(struct importShard* shard)
 {
-    //no tasks to print, return to main menu
-    if(tasks->numTasks == 0)
+    shard->fd = open(shard->path, O_RDONLY);
+    struct stat fileStat;
+    if(shard->fd < 0 || fstat(shard->fd, &fileStat) != 0)
     {
-        system("clear");
-        printf("|--------------------------------------------------\n|   There are no tasks to view.\n|   Please create a task first!\n");
-        return;
+        perror(shard->path);
+        exit(1);
+    }
+    shard->size = fileStat.st_size;
+    shard->data = malloc(shard->size + 1);
+    if(shard->data == NULL)
+    {
+        perror("Unable to allocate buffer");
+        exit(1);
     }
+}
 
-    system("clear");
-    printf("|--------------------------------------------------\n|\n|   Task Manager: View Tasks\n|\n");
+#if defined(__NR_io_uring_setup) && !defined(NO_IO_URING)
+//minimal io_uring submission and completion rings, set up with raw system calls
+struct uringQueue
+{
+    int fd;
+    unsigned entries;
+    unsigned* sqTail;
+    unsigned* sqMask;
+    unsigned* sqArray;
+    struct io_uring_sqe* sqes;
+    unsigned* cqHead;
+    unsigned* cqTail;
+    unsigned* cqMask;
+    struct io_uring_cqe* cqes;
+    void* sqRing;
+    size_t sqRingSize;
+    void* cqRing;
+    size_t cqRingSize;
+    size_t sqesSize;
+};
 
-    //traverse task list, printing each task and its attributes in correct format
-    struct task* currTask = tasks->head;
-    while(currTask != NULL)
+//sets up a ring with room for the given number of reads, returns -1 if io_uring is unavailable
+static int setupUring(struct uringQueue* ring, unsigned entries)
+{
+    struct io_uring_params params;
+    memset(&params, 0, sizeof(params));
+    memset(ring, 0, sizeof(struct uringQueue));
+
+    ring->fd = syscall(__NR_io_uring_setup, entries, &params);
+    if(ring->fd < 0)
     {
-        printf("|   %s\n", currTask->name);
-        if(currTask->complete == 1)
+        return -1;
+    }
+    ring->entries = params.sq_entries;
+
+    ring->sqRingSize = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+    ring->cqRingSize = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+    ring->sqesSize = params.sq_entries * sizeof(struct io_uring_sqe);
+    ring->sqRing = mmap(NULL, ring->sqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring->fd, IORING_OFF_SQ_RING);
+    ring->cqRing = mmap(NULL, ring->cqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring->fd, IORING_OFF_CQ_RING);
+    ring->sqes = mmap(NULL, ring->sqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring->fd, IORING_OFF_SQES);
+    if(ring->sqRing == MAP_FAILED || ring->cqRing == MAP_FAILED || ring->sqes == MAP_FAILED)
+    {
+        if(ring->sqRing != MAP_FAILED)
         {
-            printf("|   Status: Complete\n");
+            munmap(ring->sqRing, ring->sqRingSize);
         }
-        else
+        if(ring->cqRing != MAP_FAILED)
         {
-            printf("|   Status: Incomplete\n");
+            munmap(ring->cqRing, ring->cqRingSize);
         }
-        if(strcmp(currTask->category, "None") != 0)
+        if(ring->sqes != MAP_FAILED)
         {
-            printf("|   Category: %s\n", currTask->category);
+            munmap(ring->sqes, ring->sqesSize);
         }
-        printf("|   Due: %d/%d/%d\n|\n", currTask->dueDate.month, currTask->dueDate.day, currTask->dueDate.year);
-        
-        currTask = currTask->next;
+        close(ring->fd);
+        return -1;
     }
+
+    ring->sqTail = (unsigned*)((char*)ring->sqRing + params.sq_off.tail);
+    ring->sqMask = (unsigned*)((char*)ring->sqRing + params.sq_off.ring_mask);
+    ring->sqArray = (unsigned*)((char*)ring->sqRing + params.sq_off.array);
+    ring->cqHead = (unsigned*)((char*)ring->cqRing + params.cq_off.head);
+    ring->cqTail = (unsigned*)((char*)ring->cqRing + params.cq_off.tail);
+    ring->cqMask = (unsigned*)((char*)ring->cqRing + params.cq_off.ring_mask);
+    ring->cqes = (struct io_uring_cqe*)((char*)ring->cqRing + params.cq_off.cqes);
+    return 0;
 }
 
-/**********************************************************************************
-    ** Description: Prompts user for attributes of a task and creates the task.
-    Note: Tasks resulting from this function are incomplete by default.
-    ** Parameters: taskList struct to insert the task into
-**********************************************************************************/
-void createTaskFromUser(struct taskList* tasks)
+static void freeUring(struct uringQueue* ring)
 {
-    //create a new task
-    struct task* newTask = malloc(sizeof(struct task));
-    newTask->next = NULL;
-    newTask->complete = 0;
-
-    //fill out newTask info from user
-    size_t bufferSize = 32;
-    size_t charsRead = 0;
-
-    //NAME: ask user for name
-    system("clear");
-    printf("|--------------------------------------------------\n|\n|   Task Manager: Create Task\n|\n|   Please enter the NAME of the task\n|   you would like to create, and hit\n|   enter.\n|\n|   To cancel, type 'cancel' and hit enter.\n|\n|   : ");
-    
-    //NAME: malloc
-    newTask->name = (char *)malloc(bufferSize * sizeof(char));
-    memset(newTask->name, '\0', bufferSize);
-
-    //NAME: get user input
-    charsRead = getline(&(newTask->name), &bufferSize, stdin);
-    (newTask->name)[charsRead - 1] = '\0';
+    munmap(ring->sqes, ring->sqesSize);
+    munmap(ring->cqRing, ring->cqRingSize);
+    munmap(ring->sqRing, ring->sqRingSize);
+    close(ring->fd);
+}
 
-    //check if input is 'cancel'
-    if(strcmp(newTask->name, "cancel") == 0)
+//queues a read of the rest of a shard's file, tagged with the shard's index
+static void queueShardRead(struct uringQueue* ring, struct importShard* shards, int index)
+{
+    struct importShard* shard = &shards[index];
+    size_t remaining = shard->size - shard->bytesRead;
+    if(remaining > IMPORT_MAX_READ)
     {
-        free(newTask->name);
-        free(newTask);
-        return; //cancel create task operation
+        remaining = IMPORT_MAX_READ;
     }
 
-    //CATEGORY: ask user for category
-    printf("|--------------------------------------------------\n|\n|   Task Manager: Create Task\n|\n|   Please enter the CATEGORY of the\n|   task you would like to create, and\n|   hit enter.\n|\n|   To omit a category for this task,\n|   simply hit enter.\n|\n|   : ");
-
-    //CATEGORY: malloc
-    newTask->category = (char *)malloc(bufferSize * sizeof(char));
-    memset(newTask->category, '\0', bufferSize);
-
-    //CATEGORY: get user input
-    charsRead = getline(&(newTask->category), &bufferSize, stdin);
-    (newTask->category)[charsRead - 1] = '\0';
+    unsigned tail = *ring->sqTail;
+    unsigned slot = tail & *ring->sqMask;
+    struct io_uring_sqe* sqe = &ring->sqes[slot];
+    memset(sqe, 0, sizeof(struct io_uring_sqe));
+    sqe->opcode = IORING_OP_READ;
+    sqe->fd = shard->fd;
+    sqe->addr = (unsigned long)(shard->data + shard->bytesRead);
+    sqe->len = remaining;
+    sqe->off = shard->bytesRead;
+    sqe->user_data = index;
+    ring->sqArray[slot] = slot;
+
+    //publish the entry to the kernel
+    __atomic_store_n(ring->sqTail, tail + 1, __ATOMIC_RELEASE);
+}
 
-    //GATEGORY: if omitted, set to "None"
-    if((newTask->category)[0] == '\0')
+//checks the kernel can do IORING_OP_READ. it and IORING_REGISTER_PROBE both arrived in
+//Linux 5.6, so kernels with io_uring but without either use the thread pool
+static int uringSupportsRead(struct uringQueue* ring)
+{
+    size_t probeSize = sizeof(struct io_uring_probe) + 256 * sizeof(struct io_uring_probe_op);
+    struct io_uring_probe* probe = calloc(1, probeSize);
+    if(probe == NULL)
     {
-        strcpy(newTask->category, "None");       
+        return 0;
     }
 
-    //DUE DATE: malloc buffer
-    char* buffer = (char *)malloc(bufferSize * sizeof(char));
-    memset(buffer, '\0', bufferSize);
-
-    //DUE DATE: ask user for YEAR
-    printf("|--------------------------------------------------\n|\n|   Task Manager: Create Task\n|\n|   Please enter the YEAR that this\n|   task is due.\n|\n|   : ");
-    
-    //DUE DATE: get year from user
-    charsRead = getline(&buffer, &bufferSize, stdin);
-    (buffer)[charsRead - 1] = '\0';
-    newTask->dueDate.year = atoi(buffer);
-
-    //DUE DATE: ask user for MONTH
-    printf("|--------------------------------------------------\n|\n|   Task Manager: Create Task\n|\n|   Please enter the MONTH that this\n|   task is due.\n|\n|   : ");
-
-    //DUE DATE: get month from user
-    charsRead = getline(&buffer, &bufferSize, stdin);
-    (buffer)[charsRead - 1] = '\0';
-    newTask->dueDate.month = atoi(buffer);
-
-    //DUE DATE: ask user for DAY
-    printf("|--------------------------------------------------\n|\n|   Task Manager: Create Task\n|\n|   Please enter the DATE that this\n|   task is due.\n|\n|   : ");
-
-    //DUE DATE: get day from user
-    charsRead = getline(&buffer, &bufferSize, stdin);
-    (buffer)[charsRead - 1] = '\0';
-    newTask->dueDate.day = atoi(buffer);
+    int supported = syscall(__NR_io_uring_register, ring->fd, IORING_REGISTER_PROBE, probe, 256) == 0 &&
+        probe->last_op >= IORING_OP_READ && (probe->ops[IORING_OP_READ].flags & IO_URING_OP_SUPPORTED);
+    free(probe);
+    return supported;
+}
 
-    //free temp date buffer
-    free(buffer);
+/**********************************************************************************
+    ** Description: Reads every shard through one io_uring. Up to the ring's size of
+    files are open with reads in flight at once; as each file's read completes it
+    is closed and parsed while the others are still outstanding, and the next
+    file is opened in its place.
+    ** Parameters: The shards to read and how many there are
+    ** Returns: 0 on success, or -1 if io_uring is unavailable (nothing is read)
+**********************************************************************************/
+int readShardsUring(struct importShard* shards, int numShards)
+{
+    struct uringQueue ring;
+    unsigned entries = numShards < IMPORT_RING_ENTRIES ? numShards : IMPORT_RING_ENTRIES;
+    if(setupUring(&ring, entries) != 0)
+    {
+        return -1;
+    }
+    if(!uringSupportsRead(&ring))
+    {
+        freeUring(&ring);
+        return -1;
+    }
 
-    //insert newTask into tasks
-    if(tasks->head == NULL)
+    //open shards needing a read, either never started or after a short read. no more
+    //than ring.entries shards are open at once, so readQueue is used as a ring of that size
+    int* readQueue = malloc(ring.entries * sizeof(int));
+    if(readQueue == NULL)
     {
-        //if list is empty, new task is head
-        tasks->head = newTask;
+        perror("Unable to allocate buffer");
+        exit(1);
     }
-    else
+    int queueStart = 0;
+    int queueLength = 0;
+    int nextShard = 0;
+    unsigned openShards = 0;
+    int shardsLeft = numShards;
+    unsigned inFlight = 0;
+    while(shardsLeft > 0)
     {
-        struct task* currTask = tasks->head;
+        //open more files while there's room
+        while(nextShard < numShards && openShards < ring.entries)
+        {
+            struct importShard* shard = &shards[nextShard];
+            openImportShard(shard);
+            if(shard->size == 0)
+            {
+                close(shard->fd);
+                parseImportShard(shard);
+                shardsLeft--;
+            }
+            else
+            {
+                readQueue[(queueStart + queueLength) % ring.entries] = nextShard;
+                queueLength++;
+                openShards++;
+            }
+            nextShard++;
+        }
 
-        //traverse to end of list
-        while(currTask->next != NULL)
+        //top up the submission queue
+        unsigned toSubmit = 0;
+        while(queueLength > 0)
         {
-            currTask = currTask->next;
+            queueShardRead(&ring, shards, readQueue[queueStart]);
+            queueStart = (queueStart + 1) % ring.entries;
+            queueLength--;
+            toSubmit++;
+            inFlight++;
         }
 
-        //insert newTask at end of list
-        currTask->next = newTask;
-    }
+        //only empty files have been opened so far
+        if(inFlight == 0)
+        {
+            continue;
+        }
 
-    //increment total and incomplete task count
-    tasks->numTasks++;
-    tasks->incompleteTasks++;
+        //submit, and wait for at least one read to finish
+        if(syscall(__NR_io_uring_enter, ring.fd, toSubmit, 1, IORING_ENTER_GETEVENTS, NULL, 0) < 0)
+        {
+            perror("Error reading import files");
+            exit(1);
+        }
 
-    //print success message
-    printf("|--------------------------------------------------\n|   Task called '%s' created!\n", newTask->name);
-    return;
+        //parse every finished file while the remaining reads carry on
+        unsigned head = *ring.cqHead;
+        while(head != __atomic_load_n(ring.cqTail, __ATOMIC_ACQUIRE))
+        {
+            struct io_uring_cqe* cqe = &ring.cqes[head & *ring.cqMask];
+            struct importShard* shard = &shards[cqe->user_data];
+            int result = cqe->res;
+            head++;
+            __atomic_store_n(ring.cqHead, head, __ATOMIC_RELEASE);
+            inFlight--;
+
+            if(result < 0)
+            {
+                errno = -result;
+                perror(shard->path);
+                exit(1);
+            }
+            shard->bytesRead += result;
+
+            //a zero-length read means the file shrank since it was opened
+            if(result > 0 && shard->bytesRead < shard->size)
+            {
+                readQueue[(queueStart + queueLength) % ring.entries] = shard - shards;
+                queueLength++;
+                continue;
+            }
+            close(shard->fd);
+            parseImportShard(shard);
+            openShards--;
+            shardsLeft--;
+        }
+    }
+
+    free(readQueue);
+    freeUring(&ring);
+    return 0;
 }
+#else
+int readShardsUring(struct importShard* shards, int numShards)
+{
+    (void)shards;
+    (void)numShards;
+    return -1;
+}
+#endif
 
 /**********************************************************************************
-    ** Description: Frees all memory associated with a taskList
-    ** Parameters: taskList struct to free
+    ** Description: Thread pool worker used when io_uring is unavailable. Takes the
+    next unread shard, reads it with pread, and parses it, until none are left.
+    ** Parameters: The importPool shared by all workers
 **********************************************************************************/
-void freeTaskList(struct taskList* tasks)
+void* importPoolWorker(void* arg)
 {
-    //curr and next pointers
-    struct task* currTask = tasks->head;
-    struct task* nextTask;
+    struct importPool* pool = arg;
 
-    //traverse list, 
-    while(currTask != NULL)
+    while(1)
+    {
+        //claim the next shard
+        pthread_mutex_lock(&pool->lock);
+        int index = pool->nextShard++;
+        pthread_mutex_unlock(&pool->lock);
+        if(index >= pool->numShards)
+        {
+            break;
+        }
+
+        struct importShard* shard = &pool->shards[index];
+        openImportShard(shard);
+        while(shard->bytesRead < shard->size)
+        {
+            size_t remaining = shard->size - shard->bytesRead;
+            if(remaining > IMPORT_MAX_READ)
+            {
+                remaining = IMPORT_MAX_READ;
+            }
+            ssize_t result = pread(shard->fd, shard->data + shard->bytesRead, remaining, shard->bytesRead);
+            if(result < 0)
+            {
+                perror(shard->path);
+                exit(1);
+            }
+            //the file shrank since it was opened
+            if(result == 0)
+            {
+                break;
+            }
+            shard->bytesRead += result;
+        }
+        close(shard->fd);
+        parseImportShard(shard);
+    }
+
+    return NULL;
+}
+
+/**********************************************************************************
+    ** Description: Imports tasks from several correctly formatted text files at
+    once. Reads for many files are kept in flight together (through io_uring, or a
+    pool of threads when it is unavailable) and files are parsed as their reads
+    complete.
+    Tasks are appended in the order the files were given in.
+    ** Parameters: A premade taskList struct, the paths to import from, and how many
+    paths there are. The paths are freed.
+**********************************************************************************/
+void importTaskFiles(struct taskList* tasks, char** paths, int numPaths)
+{
+    //files are opened as they are read, so only a few are open at once
+    struct importShard* shards = calloc(numPaths, sizeof(struct importShard));
+    if(shards == NULL)
+    {
+        perror("Unable to allocate buffer");
+        exit(1);
+    }
+    for(int i = 0; i < numPaths; i++)
+    {
+        shards[i].path = paths[i];
+        shards[i].fd = -1;
+    }
+
+    //read and parse every file, falling back to threads if io_uring can't be used
+    if(readShardsUring(shards, numPaths) != 0)
+    {
+        struct importPool pool;
+        pool.shards = shards;
+        pool.numShards = numPaths;
+        pool.nextShard = 0;
+        pthread_mutex_init(&pool.lock, NULL);
+
+        //this thread works too, and takes on every file if no other threads can be started
+        int numThreads = numPaths < IMPORT_POOL_THREADS ? numPaths : IMPORT_POOL_THREADS;
+        pthread_t threads[IMPORT_POOL_THREADS];
+        int numStarted = 0;
+        while(numStarted < numThreads - 1 && pthread_create(&threads[numStarted], NULL, importPoolWorker, &pool) == 0)
+        {
+            numStarted++;
+        }
+        importPoolWorker(&pool);
+        for(int t = 0; t < numStarted; t++)
+        {
+            pthread_join(threads[t], NULL);
+        }
+        pthread_mutex_destroy(&pool.lock);
+    }
+
+    //append each file's tasks in the order the files were given
+    for(int i = 0; i < numPaths; i++)
+    {
+        struct importShard* shard = &shards[i];
+        if(shard->head != NULL)
+        {
+            if(tasks->head == NULL)
+            {
+                tasks->head = shard->head;
+            }
+            else
+            {
+                tasks->tail->next = shard->head;
+            }
+            tasks->tail = shard->tail;
+        }
+        mergeStringPool(&tasks->strings, &shard->strings);
+        int position = tasks->numTasks;
+        for(struct task* currTask = shard->head; currTask != NULL; currTask = currTask->next)
+        {
+            indexTask(tasks, currTask, position++);
+            if(currTask->complete == 0)
+            {
+                scheduleTask(tasks, currTask);
+            }
+        }
+        tasks->numTasks += shard->numTasks;
+        tasks->incompleteTasks += shard->incompleteTasks;
+
+        free(shard->path);
+    }
+
+    //print success message
+    system("clear");
+    printf("|--------------------------------------------------\n|   Imported %d tasks from %d files!\n", tasks->numTasks, numPaths);
+
+    free(shards);
+    free(paths);
+}
+
+/**********************************************************************************
+    ** Description: Gets the characters of a shortString, wherever they are stored.
+    ** Parameters: The shortString to read
+**********************************************************************************/
+char* stringValue(struct shortString* str)
+{
+    if(str->inlineChars[SHORT_STRING_SIZE - 1] == SHORT_STRING_POOLED)
+    {
+        return str->pooled;
+    }
+    return str->inlineChars;
+}
+
+/**********************************************************************************
+    ** Description: Stores a copy of a string in a shortString. Strings that fit
+    are kept inline; longer ones are copied into the pool.
+    ** Parameters: The shortString to set, the string to copy, and the pool for
+    strings too long to store inline
+**********************************************************************************/
+void setString(struct shortString* str, char* value, struct stringPool* pool)
+{
+    size_t length = strlen(value);
+
+    //inline strings zero the rest of the array, which also marks them as inline
+    if(length < SHORT_STRING_SIZE)
+    {
+        strncpy(str->inlineChars, value, SHORT_STRING_SIZE);
+        return;
+    }
+
+    str->pooled = poolAlloc(pool, length + 1);
+    memcpy(str->pooled, value, length + 1);
+    str->inlineChars[SHORT_STRING_SIZE - 1] = SHORT_STRING_POOLED;
+}
+
+/**********************************************************************************
+    ** Description: Allocates space for a string from a pool. Space is only given
+    back when the whole pool is freed.
+    ** Parameters: The pool to allocate from, and the number of bytes needed
+**********************************************************************************/
+char* poolAlloc(struct stringPool* pool, size_t size)
+{
+    struct poolBlock* block = pool->blocks;
+    if(block == NULL || block->size - block->used < size)
+    {
+        //strings longer than a block get a block of their own
+        size_t blockSize = size > STRING_POOL_BLOCK ? size : STRING_POOL_BLOCK;
+        block = malloc(sizeof(struct poolBlock) + blockSize);
+        if(block == NULL)
+        {
+            perror("Unable to allocate buffer");
+            exit(1);
+        }
+        block->size = blockSize;
+        block->used = 0;
+        block->next = pool->blocks;
+        pool->blocks = block;
+    }
+
+    char* space = block->data + block->used;
+    block->used += size;
+    return space;
+}
+
+/**********************************************************************************
+    ** Description: Moves every block of one pool into another, leaving it empty.
+    ** Parameters: The pool to move blocks into, and the pool to move them from
+**********************************************************************************/
+void mergeStringPool(struct stringPool* pool, struct stringPool* from)
+{
+    if(from->blocks == NULL)
+    {
+        return;
+    }
+
+    //keep pool's current block first, as it's the one with space left
+    struct poolBlock* last = from->blocks;
+    while(last->next != NULL)
+    {
+        last = last->next;
+    }
+    if(pool->blocks == NULL)
+    {
+        pool->blocks = from->blocks;
+    }
+    else
+    {
+        last->next = pool->blocks->next;
+        pool->blocks->next = from->blocks;
+    }
+    from->blocks = NULL;
+}
+
+/**********************************************************************************
+    ** Description: Frees every block of a pool.
+    ** Parameters: The pool to free
+**********************************************************************************/
+void freeStringPool(struct stringPool* pool)
+{
+    struct poolBlock* block = pool->blocks;
+    while(block != NULL)
+    {
+        struct poolBlock* next = block->next;
+        free(block);
+        block = next;
+    }
+    pool->blocks = NULL;
+}
+
+/**********************************************************************************
+    ** Description: Takes in a line from a file and creates a task struct from it.
+    ** Parameters: The current line corresponding to a task in the file, and the
+    pool to store long strings in.
+    ** Returns: The new task, or NULL if the line is missing a field
+**********************************************************************************/
+struct task* createTaskFromFile(char* currLine, struct stringPool* pool){
+    //for use with strtok_r. see https://man7.org/linux/man-pages/man3/strtok_r.3.html
+    char *saveptr;
+    const char *delim = "|";
+
+    //split the line into complete bool, task name, due date, and category
+    char *complete = strtok_r(currLine, delim, &saveptr);
+    char *name = strtok_r(NULL, delim, &saveptr);
+    char *dueDate = strtok_r(NULL, delim, &saveptr);
+    char *category = strtok_r(NULL, "\n", &saveptr);
+    if(complete == NULL || name == NULL || dueDate == NULL || category == NULL)
+    {
+        return NULL; //line is missing a field
+    }
+
+    //malloc new task object
+    struct task* currTask = malloc(sizeof(struct task));
+    currTask->complete = atoi(complete);
+
+    //task due date
+    if(createDueDate(currTask, dueDate) != 0)
     {
-        nextTask = currTask->next;
-        free(currTask->name);
-        free(currTask->category);
         free(currTask);
-        currTask = nextTask;
+        return NULL;
+    }
+
+    //task name and category
+    setString(&currTask->name, name, pool);
+    setString(&currTask->category, category, pool);
+
+    //set task node's next to null
+    currTask->followed = 0;
+    currTask->heapIndex = -1;
+    currTask->next = NULL;
+
+    return currTask;
+}
+
+/**********************************************************************************
+    ** Description: Creates a due date struct from a string when importing tasks.
+    ** Parameters: The current task corresponding to due date, and the string
+    of the due date of the form YYY_MM_DD.
+    ** Returns: 0 on success, or -1 if the year, month, or day is missing
+**********************************************************************************/
+int createDueDate(struct task* currTask, char* dueDate){
+    //dueDate takes the form of YYYY_MM_DD
+
+    char* token;
+    char* saveptr;
+    const char* delim = "_";
+
+    //year
+    token = strtok_r(dueDate, delim, &saveptr);
+    if(token == NULL)
+    {
+        return -1;
+    }
+    currTask->dueDate.year = atoi(token);
+
+    //month
+    token = strtok_r(NULL, delim, &saveptr);
+    if(token == NULL)
+    {
+        return -1;
+    }
+    currTask->dueDate.month = atoi(token);
+
+    //day
+    token = strtok_r(NULL, delim, &saveptr);
+    if(token == NULL)
+    {
+        return -1;
+    }
+    currTask->dueDate.day = atoi(token);
+    return 0;
+}
+
+/**********************************************************************************
+    ** Description: Prints a task list
+    ** Parameters: Task list struct to be printed
+**********************************************************************************/
+void viewTasks(struct taskList* tasks)
+{
+    //no tasks to print, return to main menu
+    if(tasks->numTasks == 0)
+    {
+        system("clear");
+        printf("|--------------------------------------------------\n|   There are no tasks to view.\n|   Please create a task first!\n");
+        return;
+    }
+
+    system("clear");
+    printf("|--------------------------------------------------\n|\n|   Task Manager: View Tasks\n|\n");
+
+    //traverse task list, printing each task and its attributes in correct format
+    struct task* currTask = tasks->head;
+    while(currTask != NULL)
+    {
+        printf("|   %s\n", stringValue(&currTask->name));
+        if(currTask->complete == 1)
+        {
+            printf("|   Status: Complete\n");
+        }
+        else
+        {
+            printf("|   Status: Incomplete\n");
+        }
+        if(strcmp(stringValue(&currTask->category), "None") != 0)
+        {
+            printf("|   Category: %s\n", stringValue(&currTask->category));
+        }
+        printf("|   Due: %d/%d/%d\n|\n", currTask->dueDate.month, currTask->dueDate.day, currTask->dueDate.year);
+        
+        currTask = currTask->next;
+    }
+}
+
+/**********************************************************************************
+    ** Description: Converts a date into a count of days, so dates can be compared
+    and offset by a number of days. See http://howardhinnant.github.io/date_algorithms.html
+    ** Parameters: The date to convert, which must pass isValidDate
+**********************************************************************************/
+int daysFromCivil(struct date dueDate)
+{
+    int year = dueDate.year - (dueDate.month <= 2);
+    int era = (year >= 0 ? year : year - 399) / 400;
+    int yearOfEra = year - era * 400;
+    int dayOfYear = (153 * (dueDate.month + (dueDate.month > 2 ? -3 : 9)) + 2) / 5 + dueDate.day - 1;
+    int dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;
+    return era * 146097 + dayOfEra - 719468;
+}
+
+/**********************************************************************************
+    ** Description: Works out a task's priority: its due date, moved earlier by its
+    category's weight. Lower priorities are more urgent. Tasks with invalid due
+    dates all get INVALID_DATE_PRIORITY, as their dates can't be counted in days.
+    ** Parameters: The taskList holding category weights, and the task
+**********************************************************************************/
+int taskPriority(struct taskList* tasks, struct task* currTask)
+{
+    if(!isValidDate(currTask->dueDate))
+    {
+        return INVALID_DATE_PRIORITY;
+    }
+
+    int priority = daysFromCivil(currTask->dueDate);
+    char* category = stringValue(&currTask->category);
+    for(int i = 0; i < tasks->numWeights; i++)
+    {
+        if(strcmp(tasks->weights[i].category, category) == 0)
+        {
+            priority -= tasks->weights[i].days;
+            break;
+        }
+    }
+    return priority;
+}
+
+//places a task at a position in the heap, keeping its heapIndex up to date
+static void heapPlace(struct taskList* tasks, struct task* currTask, int index)
+{
+    tasks->heap[index] = currTask;
+    currTask->heapIndex = index;
+}
+
+/**********************************************************************************
+    ** Description: Moves a task towards the top of the heap until its parent is
+    at least as urgent.
+    ** Parameters: The taskList whose heap to fix, and the task's position in it
+**********************************************************************************/
+void siftUp(struct taskList* tasks, int index)
+{
+    struct task* currTask = tasks->heap[index];
+    while(index > 0)
+    {
+        int parent = (index - 1) / 2;
+        if(tasks->heap[parent]->priority <= currTask->priority)
+        {
+            break;
+        }
+        heapPlace(tasks, tasks->heap[parent], index);
+        index = parent;
+    }
+    heapPlace(tasks, currTask, index);
+}
+
+/**********************************************************************************
+    ** Description: Moves a task towards the bottom of the heap until both of its
+    children are at least as urgent.
+    ** Parameters: The taskList whose heap to fix, and the task's position in it
+**********************************************************************************/
+void siftDown(struct taskList* tasks, int index)
+{
+    struct task* currTask = tasks->heap[index];
+    while(1)
+    {
+        int child = index * 2 + 1;
+        if(child >= tasks->heapSize)
+        {
+            break;
+        }
+        //use the more urgent child
+        if(child + 1 < tasks->heapSize && tasks->heap[child + 1]->priority < tasks->heap[child]->priority)
+        {
+            child++;
+        }
+        if(currTask->priority <= tasks->heap[child]->priority)
+        {
+            break;
+        }
+        heapPlace(tasks, tasks->heap[child], index);
+        index = child;
+    }
+    heapPlace(tasks, currTask, index);
+}
+
+/**********************************************************************************
+    ** Description: Adds an incomplete task to the schedule.
+    ** Parameters: The taskList to schedule the task in, and the task
+**********************************************************************************/
+void scheduleTask(struct taskList* tasks, struct task* currTask)
+{
+    if(tasks->heapSize == tasks->heapCapacity)
+    {
+        tasks->heapCapacity = tasks->heapCapacity == 0 ? 64 : tasks->heapCapacity * 2;
+        tasks->heap = realloc(tasks->heap, tasks->heapCapacity * sizeof(struct task*));
+        if(tasks->heap == NULL)
+        {
+            perror("Unable to allocate buffer");
+            exit(1);
+        }
+    }
+
+    currTask->priority = taskPriority(tasks, currTask);
+    heapPlace(tasks, currTask, tasks->heapSize++);
+    siftUp(tasks, currTask->heapIndex);
+}
+
+/**********************************************************************************
+    ** Description: Removes a task from the schedule, e.g. once it's complete, by
+    moving the last task of the heap into its place.
+    ** Parameters: The taskList to remove the task from, and the task
+**********************************************************************************/
+void unscheduleTask(struct taskList* tasks, struct task* currTask)
+{
+    int index = currTask->heapIndex;
+    currTask->heapIndex = -1;
+    tasks->heapSize--;
+    if(index == tasks->heapSize)
+    {
+        return;
+    }
+
+    //the moved task may belong higher or lower than where it lands
+    heapPlace(tasks, tasks->heap[tasks->heapSize], index);
+    siftUp(tasks, index);
+    siftDown(tasks, tasks->heap[index]->heapIndex);
+}
+
+/**********************************************************************************
+    ** Description: Recalculates a scheduled task's priority and moves it to its new
+    place in the heap.
+    ** Parameters: The taskList the task is scheduled in, and the task
+**********************************************************************************/
+void rescheduleTask(struct taskList* tasks, struct task* currTask)
+{
+    int oldPriority = currTask->priority;
+    currTask->priority = taskPriority(tasks, currTask);
+    if(currTask->priority < oldPriority)
+    {
+        siftUp(tasks, currTask->heapIndex);
+    }
+    else
+    {
+        siftDown(tasks, currTask->heapIndex);
+    }
+}
+
+//moves a candidate in showNextTasks() towards the top of the candidate heap
+static void siftCandidateUp(struct taskList* tasks, int* candidates, int index)
+{
+    while(index > 0 && tasks->heap[candidates[(index - 1) / 2]]->priority > tasks->heap[candidates[index]]->priority)
+    {
+        int swap = candidates[index];
+        candidates[index] = candidates[(index - 1) / 2];
+        candidates[(index - 1) / 2] = swap;
+        index = (index - 1) / 2;
+    }
+}
+
+//moves the top candidate in showNextTasks() down to its place in the candidate heap
+static void siftCandidateDown(struct taskList* tasks, int* candidates, int numCandidates)
+{
+    int index = 0;
+    while(1)
+    {
+        int child = index * 2 + 1;
+        if(child >= numCandidates)
+        {
+            break;
+        }
+        if(child + 1 < numCandidates && tasks->heap[candidates[child + 1]]->priority < tasks->heap[candidates[child]]->priority)
+        {
+            child++;
+        }
+        if(tasks->heap[candidates[index]]->priority <= tasks->heap[candidates[child]]->priority)
+        {
+            break;
+        }
+        int swap = candidates[index];
+        candidates[index] = candidates[child];
+        candidates[child] = swap;
+        index = child;
+    }
+}
+
+/**********************************************************************************
+    ** Description: Asks the user how many tasks to show, then prints that many of
+    the most urgent incomplete tasks, most urgent first. Only the part of the heap
+    holding them is visited: starting from the top, the most urgent task seen so
+    far is printed and its two children become candidates.
+    ** Parameters: taskList whose schedule to show
+**********************************************************************************/
+void showNextTasks(struct taskList* tasks)
+{
+    //no tasks to show, return to main menu
+    if(tasks->heapSize == 0)
+    {
+        system("clear");
+        printf("|--------------------------------------------------\n|   There are no incomplete tasks to do.\n|   Please create a task first!\n");
+        return;
+    }
+
+    //ask user how many tasks to show
+    system("clear");
+    printf("|--------------------------------------------------\n|\n|   Task Manager: Next Tasks\n|\n|   Please type how many tasks you would\n|   like to see, and hit enter.\n|\n|   To cancel, type 'cancel' and hit enter.\n|\n|   : ");
+    size_t bufferSize = 32;
+    char* buffer = (char *)malloc(bufferSize * sizeof(char));
+    size_t charsRead = getline(&buffer, &bufferSize, stdin);
+    if(charsRead == -1)
+    {
+        perror("Error reading input");
+        exit(1);
+    }
+    buffer[charsRead - 1] = '\0'; //remove newline character
+
+    //check if input is 'cancel'
+    if(strcmp(buffer, "cancel") == 0)
+    {
+        free(buffer);
+        return; //cancel this operation
+    }
+
+    int numToShow = atoi(buffer);
+    free(buffer);
+    if(numToShow < 1)
+    {
+        printf("|\n|   Invalid input. Please enter a valid option.\n|\n");
+        return;
+    }
+    if(numToShow > tasks->heapSize)
+    {
+        numToShow = tasks->heapSize;
+    }
+
+    //candidates is itself a heap of positions in tasks->heap; each task shown adds at
+    //most 2 more, so it never holds more than numToShow + 1
+    int* candidates = malloc((numToShow + 1) * sizeof(int));
+    int numCandidates = 1;
+    candidates[0] = 0;
+
+    system("clear");
+    printf("|--------------------------------------------------\n|\n|   Task Manager: Next Tasks\n|\n");
+    for(int i = 1; i <= numToShow; i++)
+    {
+        //take the most urgent candidate
+        struct task* currTask = tasks->heap[candidates[0]];
+        int index = candidates[0];
+        printf("|   %d. %s\n|      Due: %d/%d/%d", i, stringValue(&currTask->name), currTask->dueDate.month, currTask->dueDate.day, currTask->dueDate.year);
+        if(strcmp(stringValue(&currTask->category), "None") != 0)
+        {
+            printf(", %s", stringValue(&currTask->category));
+        }
+        printf("\n");
+
+        //replace it with the last candidate, then add its children
+        candidates[0] = candidates[--numCandidates];
+        siftCandidateDown(tasks, candidates, numCandidates);
+        for(int child = index * 2 + 1; child <= index * 2 + 2 && child < tasks->heapSize; child++)
+        {
+            candidates[numCandidates++] = child;
+            siftCandidateUp(tasks, candidates, numCandidates - 1);
+        }
+    }
+    printf("|\n");
+
+    free(candidates);
+}
+
+/**********************************************************************************
+    ** Description: Marks the most urgent incomplete task as complete.
+    ** Parameters: taskList from which to complete a task
+**********************************************************************************/
+void completeNextTask(struct taskList* tasks)
+{
+    system("clear");
+
+    //no tasks to mark as complete, return to main menu
+    if(tasks->heapSize == 0)
+    {
+        printf("|--------------------------------------------------\n|   There are no incomplete tasks to mark\n|   as complete. Please create a task first!\n");
+        return;
+    }
+
+    struct task* currTask = tasks->heap[0];
+    unscheduleTask(tasks, currTask);
+    currTask->complete = 1;
+    tasks->incompleteTasks--;
+
+    printf("|--------------------------------------------------\n|   '%s' marked as complete.\n", stringValue(&currTask->name));
+}
+
+/**********************************************************************************
+    ** Description: Asks the user for a category and a number of days, then
+    schedules that category's tasks as if they were due that many days earlier.
+    ** Parameters: taskList whose schedule to change
+**********************************************************************************/
+void prioritizeCategory(struct taskList* tasks)
+{
+    //create buffer
+    size_t bufferSize = 32;
+    size_t charsRead;
+    char* buffer = (char *)malloc(bufferSize * sizeof(char));
+    if(buffer == NULL)
+    {
+        perror("Unable to allocate buffer");
+        exit(1);
+    }
+
+    //ask user for a category
+    system("clear");
+    printf("|--------------------------------------------------\n|\n|   Task Manager: Prioritize Category\n|\n|   Please enter the CATEGORY you would\n|   like to prioritize, and hit enter.\n|\n|   To cancel, type 'cancel' and hit enter.\n|\n|   : ");
+    charsRead = getline(&buffer, &bufferSize, stdin);
+    if(charsRead == -1)
+    {
+        perror("Error reading input");
+        exit(1);
+    }
+    buffer[charsRead - 1] = '\0'; //remove newline character
+
+    //check if input is 'cancel'
+    if(strcmp(buffer, "cancel") == 0)
+    {
+        free(buffer);
+        return; //cancel this operation
+    }
+
+    //find the category's weight, if it has one
+    char* category = strdup(buffer);
+    int weight = 0;
+    while(weight < tasks->numWeights && strcmp(tasks->weights[weight].category, category) != 0)
+    {
+        weight++;
+    }
+    int currentDays = weight < tasks->numWeights ? tasks->weights[weight].days : 0;
+
+    //ask user for the number of days
+    printf("|--------------------------------------------------\n|\n|   Task Manager: Prioritize Category\n|\n|   '%s' tasks are currently\n|   scheduled %d days early.\n|\n|   Please type how many days earlier than\n|   their due date these tasks should be\n|   scheduled, and hit enter.\n|\n|   : ", category, currentDays);
+    charsRead = getline(&buffer, &bufferSize, stdin);
+    if(charsRead == -1)
+    {
+        perror("Error reading input");
+        exit(1);
+    }
+    buffer[charsRead - 1] = '\0'; //remove newline character
+
+    //check if input is a whole number of days
+    char* end;
+    long days = strtol(buffer, &end, 10);
+    if(end == buffer || *end != '\0' || days < -MAX_PRIORITY_DAYS || days > MAX_PRIORITY_DAYS)
+    {
+        printf("|\n|   Invalid input. Please enter a valid option.\n|\n");
+        free(category);
+        free(buffer);
+        return;
+    }
+    free(buffer);
+
+    //only categories that are moved keep a weight
+    if(weight < tasks->numWeights && days == 0)
+    {
+        free(tasks->weights[weight].category);
+        tasks->weights[weight] = tasks->weights[tasks->numWeights - 1];
+        tasks->numWeights--;
+    }
+    else if(weight < tasks->numWeights)
+    {
+        tasks->weights[weight].days = days;
+    }
+    else if(days != 0)
+    {
+        tasks->weights = realloc(tasks->weights, (tasks->numWeights + 1) * sizeof(struct categoryWeight));
+        if(tasks->weights == NULL)
+        {
+            perror("Unable to allocate buffer");
+            exit(1);
+        }
+        tasks->weights[weight].category = strdup(category);
+        tasks->weights[weight].days = days;
+        tasks->numWeights++;
+    }
+
+    //collect the category's scheduled tasks first, as rescheduling moves tasks around the heap
+    struct task** changed = malloc(tasks->heapSize * sizeof(struct task*));
+    int numChanged = 0;
+    for(int i = 0; i < tasks->heapSize; i++)
+    {
+        if(strcmp(stringValue(&tasks->heap[i]->category), category) == 0)
+        {
+            changed[numChanged++] = tasks->heap[i];
+        }
+    }
+    for(int i = 0; i < numChanged; i++)
+    {
+        rescheduleTask(tasks, changed[i]);
+    }
+
+    system("clear");
+    printf("|--------------------------------------------------\n|   '%s' tasks are now scheduled\n|   %ld days early.\n", category, days);
+
+    free(changed);
+    free(category);
+}
+
+/**********************************************************************************
+    ** Description: Prompts user for attributes of a task and creates the task.
+    Note: Tasks resulting from this function are incomplete by default.
+    ** Parameters: taskList struct to insert the task into
+**********************************************************************************/
+void createTaskFromUser(struct taskList* tasks)
+{
+    //create a new task
+    struct task* newTask = malloc(sizeof(struct task));
+    newTask->next = NULL;
+    newTask->complete = 0;
+    newTask->followed = 0;
+    newTask->heapIndex = -1;
+
+    //fill out newTask info from user
+    size_t bufferSize = 32;
+    size_t charsRead = 0;
+
+    //NAME: ask user for name
+    system("clear");
+    printf("|--------------------------------------------------\n|\n|   Task Manager: Create Task\n|\n|   Please enter the NAME of the task\n|   you would like to create, and hit\n|   enter.\n|\n|   To cancel, type 'cancel' and hit enter.\n|\n|   : ");
+    
+    //malloc buffer for user input
+    char* buffer = (char *)malloc(bufferSize * sizeof(char));
+    memset(buffer, '\0', bufferSize);
+
+    //NAME: get user input
+    charsRead = getline(&buffer, &bufferSize, stdin);
+    (buffer)[charsRead - 1] = '\0';
+
+    //check if input is 'cancel'
+    if(strcmp(buffer, "cancel") == 0)
+    {
+        free(buffer);
+        free(newTask);
+        return; //cancel create task operation
+    }
+    setString(&newTask->name, buffer, &tasks->strings);
+
+    //CATEGORY: ask user for category
+    printf("|--------------------------------------------------\n|\n|   Task Manager: Create Task\n|\n|   Please enter the CATEGORY of the\n|   task you would like to create, and\n|   hit enter.\n|\n|   To omit a category for this task,\n|   simply hit enter.\n|\n|   : ");
+
+    //CATEGORY: get user input
+    charsRead = getline(&buffer, &bufferSize, stdin);
+    (buffer)[charsRead - 1] = '\0';
+
+    //GATEGORY: if omitted, set to "None"
+    if((buffer)[0] == '\0')
+    {
+        setString(&newTask->category, "None", &tasks->strings);
+    }
+    else
+    {
+        setString(&newTask->category, buffer, &tasks->strings);
+    }
+
+    //DUE DATE: ask user for YEAR
+    printf("|--------------------------------------------------\n|\n|   Task Manager: Create Task\n|\n|   Please enter the YEAR that this\n|   task is due.\n|\n|   : ");
+    
+    //DUE DATE: get year from user
+    charsRead = getline(&buffer, &bufferSize, stdin);
+    (buffer)[charsRead - 1] = '\0';
+    newTask->dueDate.year = atoi(buffer);
+
+    //DUE DATE: ask user for MONTH
+    printf("|--------------------------------------------------\n|\n|   Task Manager: Create Task\n|\n|   Please enter the MONTH that this\n|   task is due.\n|\n|   : ");
+
+    //DUE DATE: get month from user
+    charsRead = getline(&buffer, &bufferSize, stdin);
+    (buffer)[charsRead - 1] = '\0';
+    newTask->dueDate.month = atoi(buffer);
+
+    //DUE DATE: ask user for DAY
+    printf("|--------------------------------------------------\n|\n|   Task Manager: Create Task\n|\n|   Please enter the DATE that this\n|   task is due.\n|\n|   : ");
+
+    //DUE DATE: get day from user
+    charsRead = getline(&buffer, &bufferSize, stdin);
+    (buffer)[charsRead - 1] = '\0';
+    newTask->dueDate.day = atoi(buffer);
+
+    //free temp input buffer
+    free(buffer);
+
+    //insert newTask into tasks
+    if(tasks->head == NULL)
+    {
+        //if list is empty, new task is head
+        tasks->head = newTask;
+    }
+    else
+    {
+        //insert newTask at end of list
+        tasks->tail->next = newTask;
+    }
+    tasks->tail = newTask;
+    indexTask(tasks, newTask, tasks->numTasks);
+
+    //increment total and incomplete task count, and schedule the task
+    tasks->numTasks++;
+    tasks->incompleteTasks++;
+    scheduleTask(tasks, newTask);
+
+    //print success message
+    printf("|--------------------------------------------------\n|   Task called '%s' created!\n", stringValue(&newTask->name));
+    return;
+}
+
+/**********************************************************************************
+    ** Description: Frees all memory associated with a taskList
+    ** Parameters: taskList struct to free
+**********************************************************************************/
+void freeTaskList(struct taskList* tasks)
+{
+    //curr and next pointers
+    struct task* currTask = tasks->head;
+    struct task* nextTask;
+
+    //traverse list, 
+    while(currTask != NULL)
+    {
+        nextTask = currTask->next;
+        free(currTask);
+        currTask = nextTask;
+    }
+
+    //free slice index, and long names and categories
+    free(tasks->slices);
+    freeStringPool(&tasks->strings);
+    freeStringPool(&tasks->followedStrings);
+
+    //free schedule
+    free(tasks->heap);
+    for(int i = 0; i < tasks->numWeights; i++)
+    {
+        free(tasks->weights[i].category);
+    }
+    free(tasks->weights);
+}
+
+/**********************************************************************************
+    ** Description: Allows user to mark a task as complete. Note, the task to mark
+    as complete isn't yet selected/passed in on this call. This function will ask
+    the user which task they would like to complete within this function
+    ** Parameters: taskList from which to mark a task as complete
+**********************************************************************************/
+void completeTask(struct taskList* tasks)
+{
+    //no tasks to mark as complete, return to main menu
+    if(tasks->incompleteTasks == 0)
+    {
+        system("clear");
+        printf("|--------------------------------------------------\n|   There are no incomplete tasks to mark\n|   as complete. Please create a task first!\n");
+        return;
+    }
+
+    //display list of incomplete tasks
+    system("clear");
+    printf("|--------------------------------------------------\n|\n|   Task Manager: Complete Task\n|\n");
+    //print task names in accordance with an incrementing number
+    struct task* currTask = tasks->head;
+    int i = 0;
+    while(currTask != NULL)
+    {
+        //print incomplete tasks
+        if(currTask->complete == 0)
+        {
+            i++;
+            printf("|   %d. %s\n", i, stringValue(&currTask->name));
+        }
+        currTask = currTask->next;
+    }
+
+    //ask user which task they want to complete
+    printf("|\n|   Please type the number that corresponds\n|   to the task you would like to mark as\n|   complete, and hit enter.\n|\n|   To cancel, type 'cancel' and hit enter.\n|\n|   : ");
+    size_t bufferSize = 32;
+    char* buffer = (char *)malloc(bufferSize * sizeof(char));
+    size_t charsRead = getline(&buffer, &bufferSize, stdin);
+    if(charsRead == -1)
+    {
+        perror("Error reading input");
+        exit(1);
+    }
+    buffer[charsRead - 1] = '\0'; //remove newline character
+
+    //check if input is 'cancel'
+    if(strcmp(buffer, "cancel") == 0)
+    {
+        free(buffer);
+        return; //cancel this operation
+    }
+
+    //convert input to int
+    int selectedTask = atoi(buffer);
+
+    //check if input is valid
+    if(selectedTask < 1 || selectedTask > tasks->incompleteTasks)
+    {
+        printf("|\n|   Invalid input. Please enter a valid option.\n|\n");
+        free(buffer);
+        return;
+    }
+
+    //find the selectedTask-th incomplete task
+    currTask = tasks->head;
+    i = 0;
+    while(currTask != NULL)
+    {
+        //if an incomplete task
+        if(currTask->complete == 0)
+        {
+            i++;
+            if(i == selectedTask)
+            {
+                //if selectedTask-th incomplete task is found
+                break;
+            }
+        }
+        currTask = currTask->next;
+    }
+
+    //mark selected task as complete
+    currTask->complete = 1;
+    tasks->incompleteTasks--;
+    unscheduleTask(tasks, currTask);
+    system("clear");
+
+    printf("|--------------------------------------------------\n|   '%s' marked as complete.\n", stringValue(&currTask->name));
+
+    free(buffer);
+}
+
+/**********************************************************************************
+    ** Description: Exports tasks in the process to a file
+    ** Parameters: taskList whose tasks to export
+**********************************************************************************/
+void exportTasks(struct taskList* tasks)
+{
+    //no tasks to export, return to main menu
+    if(tasks->numTasks == 0)
+    {
+        system("clear");
+        printf("|--------------------------------------------------\n|   There are no tasks to export.\n|   Please create a task first!\n");
+        return;
+    }
+    int fileOption = 0;
+
+    //create buffer
+    size_t bufferSize = 32;
+    size_t charsRead;
+    char* buffer = (char *)malloc(bufferSize * sizeof(char));
+    memset(buffer, '\0', bufferSize);
+    if(buffer == NULL)
+    {
+        perror("Unable to allocate buffer");
+        exit(1);
+    }
+
+    system("clear");
+    int help = 1;
+    while(help == 1)
+    {
+        //ask user if they would like to overwrite or append
+        printf("|--------------------------------------------------\n|\n|   Task Manager: Export Tasks\n|\n|   1. Overwrite file contents\n|\n|      OR\n|\n|   2. Append to existing file contents\n|\n|   Please select 1 or 2 to specify how\n|   the file you're exporting to will \n|   be affected.\n|\n|   For more information, type 'help'\n|   and hit enter.\n|\n|   To cancel, type 'cancel' and hit enter.\n|\n|  : ");
+        charsRead = getline(&buffer, &bufferSize, stdin);
+        if(charsRead == -1)
+        {
+            perror("Error reading input");
+            exit(1);
+        }
+        buffer[charsRead - 1] = '\0'; //remove newline character
+
+        //check if input is 'cancel'
+        if(strcmp(buffer, "cancel") == 0)
+        {
+            free(buffer);
+            return; //cancel this operation
+        }
+
+        //check if input is 'help'
+        if(strcmp(buffer, "help") == 0)
+        {
+            system("clear");
+            printf("|--------------------------------------------------\n|\n|   Task Manager: Help\n|\n|   For more information on how exporting\n|   to files works, visit the link\n|   below for this project's README.\n|\n|   https://github.com/MasonRosenau/task-manager?tab=readme-ov-file#exporting-tasks\n|\n");
+            continue;
+        }
+        help = 0;
+    }    
+
+    //obtain whether user wants to overwrite or append
+    fileOption = atoi(buffer);
+
+    //ask user for a file they would like to export to
+    printf("|--------------------------------------------------\n|\n|   Task Manager: Export Tasks\n|\n|   Please enter the name of the file you\n|   would like to export your tasks to, and\n|   hit enter.\n|\n|   To cancel, type 'cancel' and hit enter.\n|\n|  : ");
+    charsRead = getline(&buffer, &bufferSize, stdin);
+    if(charsRead == -1)
+    {
+        perror("Error reading input");
+        exit(1);
+    }
+    buffer[charsRead - 1] = '\0'; //remove newline character
+
+    //check if input is 'cancel'
+    if(strcmp(buffer, "cancel") == 0)
+    {
+        free(buffer);
+        return; //cancel export operation
+    }
+
+    //create file pointer for opening
+    FILE* exportFile;
+    if(fileOption == 1)
+    {
+        //open file for overwriting
+        exportFile = fopen(buffer, "w");
+    }
+    if(fileOption == 2)
+    {
+        //open file for appending
+        exportFile = fopen(buffer, "a");
+    }
+
+    //couldn't open file
+    if(!exportFile)
+    {
+        perror("Error opening file");
+        free(buffer);
+        exit(1);
+    }
+
+    //write tasks to file
+    struct task* currTask = tasks->head;
+    while(currTask != NULL)
+    {
+        fprintf(exportFile, "%d|%s|%d_%d_%d|%s\n", currTask->complete, stringValue(&currTask->name), currTask->dueDate.year, currTask->dueDate.month, currTask->dueDate.day, stringValue(&currTask->category));
+        currTask = currTask->next;
+    }
+    printf("|\n|   Tasks exported to %s!\n", buffer);
+    fclose(exportFile);
+    free(buffer);
+}
+
+/**********************************************************************************
+    ** Description: Remembers where each slice of REPORT_SLICE_TASKS tasks starts,
+    as tasks are added to the end of the list, so a report can start every thread
+    at once instead of walking the list to find where their slices begin.
+    ** Parameters: The taskList, a task just added to it, and its position in the list
+**********************************************************************************/
+void indexTask(struct taskList* tasks, struct task* currTask, int position)
+{
+    if(position % REPORT_SLICE_TASKS != 0)
+    {
+        return;
+    }
+    if(tasks->numSlices == tasks->sliceCapacity)
+    {
+        tasks->sliceCapacity = tasks->sliceCapacity == 0 ? 64 : tasks->sliceCapacity * 2;
+        tasks->slices = realloc(tasks->slices, tasks->sliceCapacity * sizeof(struct task*));
+        if(tasks->slices == NULL)
+        {
+            perror("Unable to allocate buffer");
+            exit(1);
+        }
+    }
+    tasks->slices[tasks->numSlices++] = currTask;
+}
+
+/**********************************************************************************
+    ** Description: Checks whether a date is a real day between years 1 and 9999.
+    ** Parameters: The date to check
+**********************************************************************************/
+int isValidDate(struct date dueDate)
+{
+    int daysInMonth[12] = { 31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31 };
+    if(dueDate.year < 1 || dueDate.year > 9999 || dueDate.month < 1 || dueDate.month > 12 || dueDate.day < 1)
+    {
+        return 0;
+    }
+    int leap = (dueDate.year % 4 == 0 && dueDate.year % 100 != 0) || dueDate.year % 400 == 0;
+    return dueDate.day <= daysInMonth[dueDate.month - 1] + (dueDate.month == 2 && leap);
+}
+
+//FNV-1a hash of a category name
+static unsigned hashString(const char* str)
+{
+    unsigned hash = 2166136261u;
+    for(; *str != '\0'; str++)
+    {
+        hash = (hash ^ (unsigned char)*str) * 16777619u;
+    }
+    return hash;
+}
+
+//mixes the bits of a group key so nearby keys land in different slots
+static size_t hashKey(long long key)
+{
+    unsigned long long hash = key;
+    hash = (hash ^ (hash >> 30)) * 0xbf58476d1ce4e5b9ull;
+    hash = (hash ^ (hash >> 27)) * 0x94d049bb133111ebull;
+    return hash ^ (hash >> 31);
+}
+
+/**********************************************************************************
+    ** Description: Finds the counts for a group key, adding empty counts for it
+    if it isn't in the table yet. The table doubles once it is half full.
+    ** Parameters: The groupTable to search, and the key
+    ** Returns: The group's counts, or NULL if memory ran out
+**********************************************************************************/
+static struct reportCounts* findGroup(struct groupTable* table, long long key)
+{
+    if(table->count * 2 >= table->capacity)
+    {
+        size_t capacity = table->capacity == 0 ? 64 : table->capacity * 2;
+        struct reportGroup* slots = malloc(capacity * sizeof(struct reportGroup));
+        if(slots == NULL)
+        {
+            return NULL;
+        }
+        for(size_t i = 0; i < capacity; i++)
+        {
+            slots[i].key = -1;
+        }
+
+        //move every group into the larger table
+        for(size_t i = 0; i < table->capacity; i++)
+        {
+            if(table->slots[i].key != -1)
+            {
+                size_t slot = hashKey(table->slots[i].key) & (capacity - 1);
+                while(slots[slot].key != -1)
+                {
+                    slot = (slot + 1) & (capacity - 1);
+                }
+                slots[slot] = table->slots[i];
+            }
+        }
+        free(table->slots);
+        table->slots = slots;
+        table->capacity = capacity;
+    }
+
+    size_t slot = hashKey(key) & (table->capacity - 1);
+    while(table->slots[slot].key != key)
+    {
+        if(table->slots[slot].key == -1)
+        {
+            table->slots[slot].key = key;
+            memset(&table->slots[slot].counts, 0, sizeof(struct reportCounts));
+            table->count++;
+            break;
+        }
+        slot = (slot + 1) & (table->capacity - 1);
+    }
+    return &table->slots[slot].counts;
+}
+
+/**********************************************************************************
+    ** Description: Finds a report thread's id for a category, giving it the next
+    id if the thread hasn't seen it before.
+    ** Parameters: The reportWorker, and the category name
+    ** Returns: The category's id, or -1 if memory ran out
+**********************************************************************************/
+static int findCategory(struct reportWorker* worker, char* name)
+{
+    unsigned hash = hashString(name);
+    int slot = hash & (worker->tableCapacity - 1);
+    while(worker->categoryTable[slot] != -1)
+    {
+        int id = worker->categoryTable[slot];
+        if(worker->categoryHashes[id] == hash && strcmp(worker->categories[id], name) == 0)
+        {
+            return id;
+        }
+        slot = (slot + 1) & (worker->tableCapacity - 1);
+    }
+
+    //new category: grow the per-id arrays if needed
+    if(worker->numCategories == worker->categoryCapacity)
+    {
+        int capacity = worker->categoryCapacity * 2;
+        char** categories = realloc(worker->categories, capacity * sizeof(char*));
+        if(categories == NULL)
+        {
+            return -1;
+        }
+        worker->categories = categories;
+        unsigned* hashes = realloc(worker->categoryHashes, capacity * sizeof(unsigned));
+        if(hashes == NULL)
+        {
+            return -1;
+        }
+        worker->categoryHashes = hashes;
+        struct reportCounts* counts = realloc(worker->categoryCounts, capacity * sizeof(struct reportCounts));
+        if(counts == NULL)
+        {
+            return -1;
+        }
+        worker->categoryCounts = counts;
+        worker->categoryCapacity = capacity;
+    }
+
+    int id = worker->numCategories++;
+    worker->categories[id] = name;
+    worker->categoryHashes[id] = hash;
+    memset(&worker->categoryCounts[id], 0, sizeof(struct reportCounts));
+    worker->categoryTable[slot] = id;
+
+    //keep the table at most half full
+    if(worker->numCategories * 2 >= worker->tableCapacity)
+    {
+        int capacity = worker->tableCapacity * 2;
+        int* table = malloc(capacity * sizeof(int));
+        if(table == NULL)
+        {
+            return -1;
+        }
+        memset(table, -1, capacity * sizeof(int));
+        for(int i = 0; i < worker->numCategories; i++)
+        {
+            int newSlot = worker->categoryHashes[i] & (capacity - 1);
+            while(table[newSlot] != -1)
+            {
+                newSlot = (newSlot + 1) & (capacity - 1);
+            }
+            table[newSlot] = i;
+        }
+        free(worker->categoryTable);
+        worker->categoryTable = table;
+        worker->tableCapacity = capacity;
+    }
+    return id;
+}
+
+/**********************************************************************************
+    ** Description: Counts a slice of the task list into this thread's own tables,
+    so no locking is needed. Categories get small integer ids through a hash table,
+    and tasks with invalid due dates are counted under REPORT_INVALID_MONTH.
+    ** Parameters: A reportWorker struct describing the slice to count
+**********************************************************************************/
+void* reportScanWorker(void* arg)
+{
+    struct reportWorker* worker = arg;
+    struct task* currTask = worker->first;
+
+    for(int i = 0; i < worker->count; i++, currTask = currTask->next)
+    {
+        int category = findCategory(worker, stringValue(&currTask->category));
+        if(category == -1)
+        {
+            worker->failed = 1;
+            return NULL;
+        }
+
+        //overdue tasks are incomplete tasks due before today. invalid dates are never overdue
+        struct date dueDate = currTask->dueDate;
+        int month = REPORT_INVALID_MONTH;
+        int overdue = 0;
+        if(isValidDate(dueDate))
+        {
+            month = dueDate.year * 12 + dueDate.month - 1;
+            overdue = currTask->complete == 0 &&
+                (dueDate.year < worker->today.year ||
+                (dueDate.year == worker->today.year && (dueDate.month < worker->today.month ||
+                (dueDate.month == worker->today.month && dueDate.day < worker->today.day))));
+        }
+
+        struct reportCounts* counts[2] = {
+            &worker->categoryCounts[category],
+            findGroup(&worker->pairs, (long long)category << 32 | month)
+        };
+        for(int j = 0; j < 2; j++)
+        {
+            if(counts[j] == NULL)
+            {
+                worker->failed = 1;
+                return NULL;
+            }
+            counts[j]->total++;
+            counts[j]->complete += currTask->complete == 1;
+            counts[j]->overdue += overdue;
+        }
+    }
+
+    return NULL;
+}
+
+//qsort/bsearch comparison for an array of category names
+static int compareCategories(const void* a, const void* b)
+{
+    return strcmp(*(char* const*)a, *(char* const*)b);
+}
+
+//qsort comparison for report groups, by key
+static int compareGroups(const void* a, const void* b)
+{
+    long long keyA = ((const struct reportGroup*)a)->key;
+    long long keyB = ((const struct reportGroup*)b)->key;
+    return (keyA > keyB) - (keyA < keyB);
+}
+
+//adds one set of counts into another
+static void addCounts(struct reportCounts* to, struct reportCounts* from)
+{
+    to->total += from->total;
+    to->complete += from->complete;
+    to->overdue += from->overdue;
+}
+
+/**********************************************************************************
+    ** Description: Copies the groups of a table into a new array sorted by key.
+    ** Parameters: The table, where to store the array, and where to store its length
+    ** Returns: 0 on success, or -1 if memory ran out
+**********************************************************************************/
+static int sortGroups(struct groupTable* table, struct reportGroup** groups, int* numGroups)
+{
+    *numGroups = 0;
+    *groups = malloc((table->count + 1) * sizeof(struct reportGroup));
+    if(*groups == NULL)
+    {
+        return -1;
+    }
+    for(size_t i = 0; i < table->capacity; i++)
+    {
+        if(table->slots[i].key != -1)
+        {
+            (*groups)[(*numGroups)++] = table->slots[i];
+        }
+    }
+    qsort(*groups, *numGroups, sizeof(struct reportGroup), compareGroups);
+    return 0;
+}
+
+/**********************************************************************************
+    ** Description: Combines every report thread's counts into the report. Each
+    thread's category ids are mapped onto the report's sorted category list.
+    ** Parameters: The report to fill in, the workers, and how many there are
+    ** Returns: 0 on success, or -1 if memory ran out
+**********************************************************************************/
+static int mergeReport(struct taskReport* report, struct reportWorker* workers, int numThreads)
+{
+    //merge each thread's categories into one sorted list
+    int totalCategories = 0;
+    for(int t = 0; t < numThreads; t++)
+    {
+        totalCategories += workers[t].numCategories;
+    }
+    report->categories = malloc((totalCategories + 1) * sizeof(char*));
+    if(report->categories == NULL)
+    {
+        return -1;
+    }
+    for(int t = 0; t < numThreads; t++)
+    {
+        memcpy(report->categories + report->numCategories, workers[t].categories, workers[t].numCategories * sizeof(char*));
+        report->numCategories += workers[t].numCategories;
+    }
+    qsort(report->categories, report->numCategories, sizeof(char*), compareCategories);
+    int unique = 0;
+    for(int i = 0; i < report->numCategories; i++)
+    {
+        if(unique == 0 || strcmp(report->categories[unique - 1], report->categories[i]) != 0)
+        {
+            report->categories[unique++] = report->categories[i];
+        }
+    }
+    report->numCategories = unique;
+
+    report->categoryCounts = calloc(report->numCategories + 1, sizeof(struct reportCounts));
+    int* categoryMap = malloc((totalCategories + 1) * sizeof(int));
+    struct groupTable pairs = { NULL, 0, 0 };
+    struct groupTable months = { NULL, 0, 0 };
+    int result = -1;
+    if(report->categoryCounts == NULL || categoryMap == NULL)
+    {
+        goto cleanup;
+    }
+
+    //add each thread's counts in, under the report's category ids
+    for(int t = 0; t < numThreads; t++)
+    {
+        struct reportWorker* worker = &workers[t];
+        for(int i = 0; i < worker->numCategories; i++)
+        {
+            char** found = bsearch(&worker->categories[i], report->categories, report->numCategories, sizeof(char*), compareCategories);
+            categoryMap[i] = found - report->categories;
+            addCounts(&report->categoryCounts[categoryMap[i]], &worker->categoryCounts[i]);
+        }
+        for(size_t i = 0; i < worker->pairs.capacity; i++)
+        {
+            struct reportGroup* group = &worker->pairs.slots[i];
+            if(group->key == -1)
+            {
+                continue;
+            }
+            long long key = (long long)categoryMap[group->key >> 32] << 32 | (group->key & 0xffffffff);
+            struct reportCounts* counts = findGroup(&pairs, key);
+            struct reportCounts* monthCounts = findGroup(&months, group->key & 0xffffffff);
+            if(counts == NULL || monthCounts == NULL)
+            {
+                goto cleanup;
+            }
+            addCounts(counts, &group->counts);
+            addCounts(monthCounts, &group->counts);
+        }
+    }
+
+    if(sortGroups(&months, &report->months, &report->numMonths) == 0 &&
+        sortGroups(&pairs, &report->pairs, &report->numPairs) == 0)
+    {
+        result = 0;
+    }
+
+cleanup:
+    free(categoryMap);
+    free(pairs.slots);
+    free(months.slots);
+    return result;
+}
+
+/**********************************************************************************
+    ** Description: Computes grouped counts, completion and overdue totals per
+    category, per due month, and per (category, month) pair. Large lists are split
+    across threads, each counting into its own tables which are merged at the end.
+    ** Parameters: The taskList to report on and the taskReport to fill in
+    ** Returns: 0 on success, or -1 if memory ran out (the report is left empty)
+**********************************************************************************/
+int buildReport(struct taskList* tasks, struct taskReport* report)
+{
+    int numTasks = tasks->numTasks;
+    memset(report, 0, sizeof(struct taskReport));
+
+    //get today's date for overdue checks
+    time_t now = time(NULL);
+    struct tm* local = localtime(&now);
+    struct date today = { local->tm_year + 1900, local->tm_mon + 1, local->tm_mday };
+
+    //use one thread per core for large lists
+    int numThreads = 1;
+    if(numTasks >= REPORT_THREAD_THRESHOLD)
+    {
+        numThreads = sysconf(_SC_NPROCESSORS_ONLN);
+        if(numThreads < 1)
+        {
+            numThreads = 1;
+        }
+        if(numThreads > REPORT_MAX_THREADS)
+        {
+            numThreads = REPORT_MAX_THREADS;
+        }
+        if(numThreads > tasks->numSlices)
+        {
+            numThreads = tasks->numSlices > 0 ? tasks->numSlices : 1;
+        }
+    }
+
+    //give each thread a run of whole slices, found through the list's slice index
+    struct reportWorker workers[REPORT_MAX_THREADS];
+    pthread_t threads[REPORT_MAX_THREADS];
+    int started[REPORT_MAX_THREADS];
+    int failed = 0;
+    for(int t = 0; t < numThreads; t++)
+    {
+        struct reportWorker* worker = &workers[t];
+        memset(worker, 0, sizeof(struct reportWorker));
+        int firstSlice = tasks->numSlices * t / numThreads;
+        int nextSlice = tasks->numSlices * (t + 1) / numThreads;
+        worker->first = numThreads == 1 ? tasks->head : tasks->slices[firstSlice];
+        worker->count = (t == numThreads - 1 ? numTasks : nextSlice * REPORT_SLICE_TASKS) - firstSlice * REPORT_SLICE_TASKS;
+        worker->today = today;
+        worker->categoryCapacity = 8;
+        worker->categories = malloc(worker->categoryCapacity * sizeof(char*));
+        worker->categoryHashes = malloc(worker->categoryCapacity * sizeof(unsigned));
+        worker->categoryCounts = malloc(worker->categoryCapacity * sizeof(struct reportCounts));
+        worker->tableCapacity = 16;
+        worker->categoryTable = malloc(worker->tableCapacity * sizeof(int));
+        if(!worker->categories || !worker->categoryHashes || !worker->categoryCounts || !worker->categoryTable)
+        {
+            failed = 1;
+        }
+        else
+        {
+            memset(worker->categoryTable, -1, worker->tableCapacity * sizeof(int));
+        }
+    }
+
+    if(failed == 0)
+    {
+        //a slice whose thread can't be started is counted on this thread instead
+        for(int t = 1; t < numThreads; t++)
+        {
+            started[t] = pthread_create(&threads[t], NULL, reportScanWorker, &workers[t]) == 0;
+        }
+        reportScanWorker(&workers[0]);
+        for(int t = 1; t < numThreads; t++)
+        {
+            if(started[t])
+            {
+                pthread_join(threads[t], NULL);
+            }
+            else
+            {
+                reportScanWorker(&workers[t]);
+            }
+        }
+
+        for(int t = 0; t < numThreads; t++)
+        {
+            failed |= workers[t].failed;
+        }
+        if(failed == 0 && mergeReport(report, workers, numThreads) != 0)
+        {
+            failed = 1;
+        }
+    }
+
+    //free each thread's state
+    for(int t = 0; t < numThreads; t++)
+    {
+        free(workers[t].categories);
+        free(workers[t].categoryHashes);
+        free(workers[t].categoryCounts);
+        free(workers[t].categoryTable);
+        free(workers[t].pairs.slots);
+    }
+
+    if(failed)
+    {
+        freeReport(report);
+        return -1;
+    }
+    return 0;
+}
+
+//prints a string as a quoted CSV or JSON field, escaping what JSON requires
+static void printQuoted(FILE* out, const char* str, int format)
+{
+    fputc('"', out);
+    for(; *str != '\0'; str++)
+    {
+        if(*str == '"')
+        {
+            fputs(format == REPORT_CSV ? "\"\"" : "\\\"", out);
+        }
+        else if(*str == '\\' && format == REPORT_JSON)
+        {
+            fputs("\\\\", out);
+        }
+        else if((unsigned char)*str < 0x20 && format == REPORT_JSON)
+        {
+            //JSON strings can't hold raw control characters, such as the '\r' of CRLF files
+            if(*str == '\n')
+            {
+                fputs("\\n", out);
+            }
+            else if(*str == '\r')
+            {
+                fputs("\\r", out);
+            }
+            else if(*str == '\t')
+            {
+                fputs("\\t", out);
+            }
+            else
+            {
+                fprintf(out, "\\u%04x", (unsigned char)*str);
+            }
+        }
+        else
+        {
+            fputc(*str, out);
+        }
+    }
+    fputc('"', out);
+}
+
+//prints one report row in the given format. category and/or month may be omitted with NULL/-1
+static void printReportRow(FILE* out, int format, const char* group, const char* category, long long month, struct reportCounts* counts, int first)
+{
+    double rate = 100.0 * counts->complete / counts->total;
+    char monthStr[16] = "";
+    if(month == REPORT_INVALID_MONTH)
+    {
+        strcpy(monthStr, "invalid");
+    }
+    else if(month != -1)
+    {
+        snprintf(monthStr, sizeof(monthStr), "%04d-%02d", (int)(month / 12), (int)(month % 12 + 1));
+    }
+
+    if(format == REPORT_CSV)
+    {
+        fprintf(out, "%s,", group);
+        if(category != NULL)
+        {
+            printQuoted(out, category, format);
+        }
+        fprintf(out, ",%s,%d,%d,%.1f,%d\n", monthStr, counts->total, counts->complete, rate, counts->overdue);
+    }
+    else if(format == REPORT_JSON)
+    {
+        fprintf(out, "%s\n    {", first ? "" : ",");
+        if(category != NULL)
+        {
+            fprintf(out, "\"category\": ");
+            printQuoted(out, category, format);
+            fprintf(out, ", ");
+        }
+        if(month != -1)
+        {
+            fprintf(out, "\"month\": \"%s\", ", monthStr);
+        }
+        fprintf(out, "\"tasks\": %d, \"complete\": %d, \"completionRate\": %.1f, \"overdue\": %d}", counts->total, counts->complete, rate, counts->overdue);
+    }
+    else
+    {
+        fprintf(out, "|   %-20.20s %-8s %9d %9d %8.1f%% %8d\n", category != NULL ? category : "", monthStr, counts->total, counts->complete, rate, counts->overdue);
+    }
+}
+
+/**********************************************************************************
+    ** Description: Prints a report as a table, CSV, or JSON. Tasks with invalid
+    due dates are grouped under the month "invalid".
+    ** Parameters: The report to print, the stream to print it to, and the format
+    (REPORT_TABLE, REPORT_CSV, or REPORT_JSON)
+**********************************************************************************/
+void printReport(struct taskReport* report, FILE* out, int format)
+{
+    const char* groups[3] = { "category", "month", "category_month" };
+    const char* titles[3] = { "By Category", "By Due Month", "By Category and Due Month" };
+    int numRows[3] = { report->numCategories, report->numMonths, report->numPairs };
+
+    if(format == REPORT_CSV)
+    {
+        fprintf(out, "group,category,month,tasks,complete,completion_rate,overdue\n");
+    }
+    else if(format == REPORT_JSON)
+    {
+        fprintf(out, "{");
+    }
+
+    for(int g = 0; g < 3; g++)
+    {
+        if(format == REPORT_JSON)
+        {
+            fprintf(out, "%s\n  \"%s\": [", g == 0 ? "" : ",", groups[g]);
+        }
+        else if(format == REPORT_TABLE)
+        {
+            fprintf(out, "|--------------------------------------------------\n|\n|   %s\n|\n|   %-20s %-8s %9s %9s %9s %8s\n", titles[g], "Category", "Month", "Tasks", "Complete", "Rate", "Overdue");
+        }
+
+        for(int i = 0; i < numRows[g]; i++)
+        {
+            if(g == 0)
+            {
+                printReportRow(out, format, groups[g], report->categories[i], -1, &report->categoryCounts[i], i == 0);
+            }
+            else if(g == 1)
+            {
+                printReportRow(out, format, groups[g], NULL, report->months[i].key, &report->months[i].counts, i == 0);
+            }
+            else
+            {
+                struct reportGroup* pair = &report->pairs[i];
+                printReportRow(out, format, groups[g], report->categories[pair->key >> 32], pair->key & 0xffffffff, &pair->counts, i == 0);
+            }
+        }
+
+        if(format == REPORT_JSON)
+        {
+            fprintf(out, "\n  ]");
+        }
+        else if(format == REPORT_TABLE)
+        {
+            fprintf(out, "|\n");
+        }
+    }
+
+    if(format == REPORT_JSON)
+    {
+        fprintf(out, "\n}\n");
+    }
+}
+
+/**********************************************************************************
+    ** Description: Frees all memory associated with a taskReport. The category
+    names belong to the tasks and are not freed here.
+    ** Parameters: taskReport struct to free
+**********************************************************************************/
+void freeReport(struct taskReport* report)
+{
+    free(report->categories);
+    free(report->categoryCounts);
+    free(report->months);
+    free(report->pairs);
+    memset(report, 0, sizeof(struct taskReport));
+}
+
+/**********************************************************************************
+    ** Description: Asks the user for a report format and destination, then builds
+    and prints a grouped report of all tasks.
+    ** Parameters: taskList to report on
+**********************************************************************************/
+void reportTasks(struct taskList* tasks)
+{
+    //no tasks to report on, return to main menu
+    if(tasks->numTasks == 0)
+    {
+        system("clear");
+        printf("|--------------------------------------------------\n|   There are no tasks to report on.\n|   Please create a task first!\n");
+        return;
+    }
+
+    //create buffer
+    size_t bufferSize = 32;
+    size_t charsRead;
+    char* buffer = (char *)malloc(bufferSize * sizeof(char));
+    if(buffer == NULL)
+    {
+        perror("Unable to allocate buffer");
+        exit(1);
+    }
+    memset(buffer, '\0', bufferSize);
+
+    //ask user for a format
+    system("clear");
+    printf("|--------------------------------------------------\n|\n|   Task Manager: Report\n|\n|   1. Table\n|   2. CSV\n|   3. JSON\n|\n|   Please select 1, 2, or 3 to choose\n|   the format of the report.\n|\n|   To cancel, type 'cancel' and hit enter.\n|\n|  : ");
+    charsRead = getline(&buffer, &bufferSize, stdin);
+    if(charsRead == -1)
+    {
+        perror("Error reading input");
+        exit(1);
+    }
+    buffer[charsRead - 1] = '\0'; //remove newline character
+
+    //check if input is 'cancel'
+    if(strcmp(buffer, "cancel") == 0)
+    {
+        free(buffer);
+        return; //cancel this operation
+    }
+
+    int format = atoi(buffer);
+    if(format < REPORT_TABLE || format > REPORT_JSON)
+    {
+        printf("|\n|   Invalid input. Please enter a valid option.\n|\n");
+        free(buffer);
+        return;
+    }
+
+    //ask user where the report should go
+    printf("|--------------------------------------------------\n|\n|   Task Manager: Report\n|\n|   Please enter the name of the file you\n|   would like to write the report to, and\n|   hit enter.\n|\n|   To print the report here instead,\n|   simply hit enter.\n|\n|  : ");
+    charsRead = getline(&buffer, &bufferSize, stdin);
+    if(charsRead == -1)
+    {
+        perror("Error reading input");
+        exit(1);
+    }
+    buffer[charsRead - 1] = '\0'; //remove newline character
+
+    FILE* reportFile = stdout;
+    if(buffer[0] != '\0')
+    {
+        reportFile = fopen(buffer, "w");
+        if(!reportFile)
+        {
+            perror("Error opening file");
+            free(buffer);
+            return;
+        }
+    }
+
+    //a report only reads the tasks, so failing to build one returns to the menu
+    struct taskReport report;
+    if(buildReport(tasks, &report) != 0)
+    {
+        printf("|--------------------------------------------------\n|   Not enough memory to build the report.\n");
+        if(reportFile != stdout)
+        {
+            fclose(reportFile);
+        }
+        free(buffer);
+        return;
+    }
+
+    system("clear");
+    printReport(&report, reportFile, format);
+    if(reportFile != stdout)
+    {
+        printf("|--------------------------------------------------\n|   Report written to %s!\n", buffer);
+        fclose(reportFile);
     }
+
+    freeReport(&report);
+    free(buffer);
 }
 
 /**********************************************************************************
-    ** Description: Allows user to mark a task as complete. Note, the task to mark
-    as complete isn't yet selected/passed in on this call. This function will ask
-    the user which task they would like to complete within this function
-    ** Parameters: taskList from which to mark a task as complete
+    ** Description: Sets up a followState for the file tasks were imported from.
+    Following doesn't start until startFollow() is called.
+    ** Parameters: The followState to set up, and the imported file's name and open
+    file. The offset is set once the file has been imported.
 **********************************************************************************/
-void completeTask(struct taskList* tasks)
+void initFollow(struct followState* follow, char* path, FILE* importFile)
 {
-    //no tasks to mark as complete, return to main menu
-    if(tasks->incompleteTasks == 0)
+    struct stat fileStat;
+    fstat(fileno(importFile), &fileStat);
+
+    follow->path = strdup(path);
+    follow->inotifyFd = -1;
+    follow->fileWatch = -1;
+    follow->dirWatch = -1;
+    follow->device = fileStat.st_dev;
+    follow->inode = fileStat.st_ino;
+    follow->offset = 0;
+    follow->tailLength = -1;
+}
+
+/**********************************************************************************
+    ** Description: Remembers the last bytes imported from the followed file, once
+    the import has finished, so a later rewrite of those bytes can be noticed.
+    ** Parameters: The followState, with its offset set
+**********************************************************************************/
+void recordFollowTail(struct followState* follow)
+{
+    int fd = open(follow->path, O_RDONLY);
+    if(fd == -1)
     {
-        system("clear");
-        printf("|--------------------------------------------------\n|   There are no incomplete tasks to mark\n|   as complete. Please create a task first!\n");
         return;
     }
 
-    //display list of incomplete tasks
-    system("clear");
-    printf("|--------------------------------------------------\n|\n|   Task Manager: Complete Task\n|\n");
-    //print task names in accordance with an incrementing number
-    struct task* currTask = tasks->head;
-    int i = 0;
-    while(currTask != NULL)
+    //if the file was replaced since it was imported, the tail stays unknown so it's reloaded
+    struct stat fileStat;
+    if(fstat(fd, &fileStat) == 0 && fileStat.st_ino == follow->inode && fileStat.st_dev == follow->device)
     {
-        //print incomplete tasks
-        if(currTask->complete == 0)
-        {
-            i++;
-            printf("|   %d. %s\n", i, currTask->name);
-        }
-        currTask = currTask->next;
+        follow->tailLength = readFollowTail(follow->offset, fd, follow->tail);
     }
+    close(fd);
+}
 
-    //ask user which task they want to complete
-    printf("|\n|   Please type the number that corresponds\n|   to the task you would like to mark as\n|   complete, and hit enter.\n|\n|   To cancel, type 'cancel' and hit enter.\n|\n|   : ");
-    size_t bufferSize = 32;
-    char* buffer = (char *)malloc(bufferSize * sizeof(char));
-    size_t charsRead = getline(&buffer, &bufferSize, stdin);
-    if(charsRead == -1)
+/**********************************************************************************
+    ** Description: Reads up to FOLLOW_TAIL_SIZE bytes of a file, ending at offset.
+    ** Parameters: The offset the bytes end at, the open file, and where to store them
+    ** Returns: The number of bytes read, or -1 if they couldn't all be read
+**********************************************************************************/
+int readFollowTail(off_t offset, int fd, char* tail)
+{
+    int length = offset < FOLLOW_TAIL_SIZE ? offset : FOLLOW_TAIL_SIZE;
+    if(pread(fd, tail, length, offset - length) != length)
     {
-        perror("Error reading input");
-        exit(1);
+        return -1;
     }
-    buffer[charsRead - 1] = '\0'; //remove newline character
+    return length;
+}
 
-    //check if input is 'cancel'
-    if(strcmp(buffer, "cancel") == 0)
+/**********************************************************************************
+    ** Description: Starts watching the followed file, and the directory it's in
+    (so a replacement file is noticed), then picks up any changes made since it
+    was imported.
+    ** Parameters: The followState to start, and the taskList to add tasks to
+    ** Returns: 0 on success, or -1 if the file can't be watched
+**********************************************************************************/
+int startFollow(struct followState* follow, struct taskList* tasks)
+{
+    follow->inotifyFd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if(follow->inotifyFd == -1)
     {
-        free(buffer);
-        return; //cancel this operation
+        return -1;
     }
 
-    //convert input to int
-    int selectedTask = atoi(buffer);
+    //dirname() may modify its argument, so give it a copy
+    char* dirCopy = strdup(follow->path);
+    follow->dirWatch = inotify_add_watch(follow->inotifyFd, dirname(dirCopy), FOLLOW_DIR_EVENTS);
+    free(dirCopy);
+    follow->fileWatch = inotify_add_watch(follow->inotifyFd, follow->path, FOLLOW_FILE_EVENTS);
+    if(follow->dirWatch == -1 || follow->fileWatch == -1)
+    {
+        stopFollow(follow);
+        return -1;
+    }
 
-    //check if input is valid
-    if(selectedTask < 1 || selectedTask > tasks->incompleteTasks)
+    syncFollow(follow, tasks);
+    return 0;
+}
+
+/**********************************************************************************
+    ** Description: Stops watching the followed file. Safe to call when not following.
+    ** Parameters: The followState to stop
+**********************************************************************************/
+void stopFollow(struct followState* follow)
+{
+    if(follow->inotifyFd != -1)
     {
-        printf("|\n|   Invalid input. Please enter a valid option.\n|\n");
-        free(buffer);
-        return;
+        //closing the inotify instance removes all of its watches
+        close(follow->inotifyFd);
     }
+    follow->inotifyFd = -1;
+    follow->fileWatch = -1;
+    follow->dirWatch = -1;
+}
 
-    //find the selectedTask-th incomplete task
-    currTask = tasks->head;
-    i = 0;
-    while(currTask != NULL)
+/**********************************************************************************
+    ** Description: Brings the task list up to date with the followed file. Only
+    whole lines appended since the last read are parsed. If the file was truncated,
+    replaced, or rewritten (the last bytes read have changed), every task from it
+    is removed and the file is reloaded.
+    ** Parameters: The followState being followed, and the taskList to update
+    ** Returns: 1 if the task list changed, otherwise 0
+**********************************************************************************/
+int syncFollow(struct followState* follow, struct taskList* tasks)
+{
+    //the file may briefly not exist while another tool replaces it
+    int fd = open(follow->path, O_RDONLY);
+    if(fd == -1)
     {
-        //if an incomplete task
-        if(currTask->complete == 0)
-        {
-            i++;
-            if(i == selectedTask)
-            {
-                //if selectedTask-th incomplete task is found
-                break;
-            }
-        }
-        currTask = currTask->next;
+        return 0;
+    }
+    struct stat fileStat;
+    if(fstat(fd, &fileStat) != 0)
+    {
+        close(fd);
+        return 0;
     }
 
-    //mark selected task as complete
-    currTask->complete = 1;
-    tasks->incompleteTasks--;
-    system("clear");
+    char tail[FOLLOW_TAIL_SIZE];
+    int reload = 0;
+    if(fileStat.st_ino != follow->inode || fileStat.st_dev != follow->device)
+    {
+        //replaced: move the file watch over to the new file
+        inotify_rm_watch(follow->inotifyFd, follow->fileWatch);
+        follow->fileWatch = inotify_add_watch(follow->inotifyFd, follow->path, FOLLOW_FILE_EVENTS);
+        follow->device = fileStat.st_dev;
+        follow->inode = fileStat.st_ino;
+        reload = 1;
+    }
+    else if(fileStat.st_size < follow->offset)
+    {
+        //truncated
+        reload = 1;
+    }
+    else if(follow->tailLength == -1 || readFollowTail(follow->offset, fd, tail) != follow->tailLength ||
+            memcmp(tail, follow->tail, follow->tailLength) != 0)
+    {
+        //rewritten in place, so offset may now be partway through a line
+        reload = 1;
+    }
+    else if(fileStat.st_size == follow->offset)
+    {
+        close(fd);
+        return 0;
+    }
 
-    printf("|--------------------------------------------------\n|   '%s' marked as complete.\n", currTask->name);
+    if(reload == 1)
+    {
+        removeFollowedTasks(tasks);
+        follow->offset = 0;
+    }
+    int added = readFollowedTasks(tasks, fd, &follow->offset);
+    follow->tailLength = readFollowTail(follow->offset, fd, follow->tail);
+    close(fd);
 
-    free(buffer);
+    if(reload == 1)
+    {
+        printf("|--------------------------------------------------\n|   '%s' was replaced or rewritten.\n|   Reloaded %d tasks from it.\n", follow->path, added);
+    }
+    else if(added > 0)
+    {
+        printf("|--------------------------------------------------\n|   Added %d new tasks from '%s'.\n", added, follow->path);
+    }
+    return reload == 1 || added > 0;
 }
 
 /**********************************************************************************
-    ** Description: Exports tasks in the process to a file
-    ** Parameters: taskList whose tasks to export
+    ** Description: Reads the whole lines of a file past the given offset, and
+    appends a task for each to the end of the list. A partial last line is left
+    for the next read, once the rest of it has been written.
+    ** Parameters: The taskList to add to, the open file, and the offset to read
+    from, which is advanced past the lines read
+    ** Returns: The number of tasks added
 **********************************************************************************/
-void exportTasks(struct taskList* tasks)
+int readFollowedTasks(struct taskList* tasks, int fd, off_t* offset)
 {
-    //no tasks to export, return to main menu
-    if(tasks->numTasks == 0)
+    struct stat fileStat;
+    if(fstat(fd, &fileStat) != 0 || fileStat.st_size <= *offset)
     {
-        system("clear");
-        printf("|--------------------------------------------------\n|   There are no tasks to export.\n|   Please create a task first!\n");
-        return;
+        return 0;
     }
-    int fileOption = 0;
 
-    //create buffer
-    size_t bufferSize = 32;
-    size_t charsRead;
-    char* buffer = (char *)malloc(bufferSize * sizeof(char));
-    memset(buffer, '\0', bufferSize);
-    if(buffer == NULL)
+    struct importShard shard;
+    memset(&shard, 0, sizeof(struct importShard));
+    shard.size = fileStat.st_size - *offset;
+    shard.data = malloc(shard.size + 1);
+    if(shard.data == NULL)
     {
         perror("Unable to allocate buffer");
         exit(1);
     }
-
-    system("clear");
-    int help = 1;
-    while(help == 1)
+    while(shard.bytesRead < shard.size)
     {
-        //ask user if they would like to overwrite or append
-        printf("|--------------------------------------------------\n|\n|   Task Manager: Export Tasks\n|\n|   1. Overwrite file contents\n|\n|      OR\n|\n|   2. Append to existing file contents\n|\n|   Please select 1 or 2 to specify how\n|   the file you're exporting to will \n|   be affected.\n|\n|   For more information, type 'help'\n|   and hit enter.\n|\n|   To cancel, type 'cancel' and hit enter.\n|\n|  : ");
-        charsRead = getline(&buffer, &bufferSize, stdin);
-        if(charsRead == -1)
+        ssize_t result = pread(fd, shard.data + shard.bytesRead, shard.size - shard.bytesRead, *offset + shard.bytesRead);
+        if(result <= 0)
         {
-            perror("Error reading input");
-            exit(1);
+            break;
         }
-        buffer[charsRead - 1] = '\0'; //remove newline character
+        shard.bytesRead += result;
+    }
 
-        //check if input is 'cancel'
-        if(strcmp(buffer, "cancel") == 0)
+    //only parse up to the last newline
+    char* lastNewline = memrchr(shard.data, '\n', shard.bytesRead);
+    if(lastNewline == NULL)
+    {
+        free(shard.data);
+        return 0;
+    }
+    shard.bytesRead = lastNewline - shard.data + 1;
+    *offset += shard.bytesRead;
+
+    //parse straight into the followed pool, so small syncs fill its current block
+    shard.strings = tasks->followedStrings;
+    parseImportShard(&shard);
+    tasks->followedStrings = shard.strings;
+
+    //mark the new tasks as followed and schedule them, then append them
+    int position = tasks->numTasks;
+    for(struct task* currTask = shard.head; currTask != NULL; currTask = currTask->next)
+    {
+        currTask->followed = 1;
+        indexTask(tasks, currTask, position++);
+        if(currTask->complete == 0)
         {
-            free(buffer);
-            return; //cancel this operation
+            scheduleTask(tasks, currTask);
         }
-
-        //check if input is 'help'
-        if(strcmp(buffer, "help") == 0)
+    }
+    if(shard.head != NULL)
+    {
+        if(tasks->head == NULL)
         {
-            system("clear");
-            printf("|--------------------------------------------------\n|\n|   Task Manager: Help\n|\n|   For more information on how exporting\n|   to files works, visit the link\n|   below for this project's README.\n|\n|   https://github.com/MasonRosenau/task-manager?tab=readme-ov-file#exporting-tasks\n|\n");
-            continue;
+            tasks->head = shard.head;
         }
-        help = 0;
-    }    
+        else
+        {
+            tasks->tail->next = shard.head;
+        }
+        tasks->tail = shard.tail;
+    }
+    tasks->numTasks += shard.numTasks;
+    tasks->incompleteTasks += shard.incompleteTasks;
 
-    //obtain whether user wants to overwrite or append
-    fileOption = atoi(buffer);
+    return shard.numTasks;
+}
 
-    //ask user for a file they would like to export to
-    printf("|--------------------------------------------------\n|\n|   Task Manager: Export Tasks\n|\n|   Please enter the name of the file you\n|   would like to export your tasks to, and\n|   hit enter.\n|\n|   To cancel, type 'cancel' and hit enter.\n|\n|  : ");
-    charsRead = getline(&buffer, &bufferSize, stdin);
-    if(charsRead == -1)
+/**********************************************************************************
+    ** Description: Removes and frees every task that came from the followed file,
+    along with the pool holding their long names and categories.
+    ** Parameters: The taskList to remove tasks from
+**********************************************************************************/
+void removeFollowedTasks(struct taskList* tasks)
+{
+    //link points at whichever next pointer leads to currTask. the tail and slices
+    //are found again from the tasks that are kept
+    struct task** link = &tasks->head;
+    int position = 0;
+    tasks->tail = NULL;
+    tasks->numSlices = 0;
+    while(*link != NULL)
     {
-        perror("Error reading input");
-        exit(1);
+        struct task* currTask = *link;
+        if(currTask->followed == 1)
+        {
+            *link = currTask->next;
+            tasks->numTasks--;
+            if(currTask->complete == 0)
+            {
+                tasks->incompleteTasks--;
+                unscheduleTask(tasks, currTask);
+            }
+            free(currTask);
+        }
+        else
+        {
+            tasks->tail = currTask;
+            indexTask(tasks, currTask, position++);
+            link = &currTask->next;
+        }
     }
-    buffer[charsRead - 1] = '\0'; //remove newline character
+    freeStringPool(&tasks->followedStrings);
+}
 
-    //check if input is 'cancel'
-    if(strcmp(buffer, "cancel") == 0)
+/**********************************************************************************
+    ** Description: Waits for the user to type a line of input. While following,
+    changes to the followed file are synced as they happen in the meantime.
+    ** Parameters: The followState, and the taskList to update
+**********************************************************************************/
+void waitForInput(struct followState* follow, struct taskList* tasks)
+{
+    if(follow->inotifyFd == -1)
     {
-        free(buffer);
-        return; //cancel export operation
+        return;
     }
 
-    //create file pointer for opening
-    FILE* exportFile;
-    if(fileOption == 1)
+    //input that isn't from a terminal may already be buffered by stdio where poll()
+    //can't see it, so just sync once rather than waiting
+    if(!isatty(STDIN_FILENO))
     {
-        //open file for overwriting
-        exportFile = fopen(buffer, "w");
+        drainFollowEvents(follow);
+        syncFollow(follow, tasks);
+        return;
     }
-    if(fileOption == 2)
+
+    struct pollfd fds[2];
+    fds[0].fd = STDIN_FILENO;
+    fds[0].events = POLLIN;
+    fds[1].fd = follow->inotifyFd;
+    fds[1].events = POLLIN;
+    while(1)
     {
-        //open file for appending
-        exportFile = fopen(buffer, "a");
+        if(poll(fds, 2, -1) == -1)
+        {
+            if(errno == EINTR)
+            {
+                continue;
+            }
+            perror("Error waiting for input");
+            exit(1);
+        }
+
+        //sync, then show the prompt again beneath the sync message
+        if(fds[1].revents & POLLIN)
+        {
+            drainFollowEvents(follow);
+            if(syncFollow(follow, tasks) == 1)
+            {
+                printf("|\n|   : ");
+                fflush(stdout);
+            }
+        }
+        if(fds[0].revents != 0)
+        {
+            return;
+        }
     }
+}
 
-    //couldn't open file
-    if(!exportFile)
+/**********************************************************************************
+    ** Description: Reads and discards every pending inotify event. The events
+    themselves aren't needed, as syncFollow() checks the file directly.
+    ** Parameters: The followState whose events to discard
+**********************************************************************************/
+void drainFollowEvents(struct followState* follow)
+{
+    char events[4096] __attribute__((aligned(__alignof__(struct inotify_event))));
+    while(read(follow->inotifyFd, events, sizeof(events)) > 0)
     {
-        perror("Error opening file");
-        free(buffer);
-        exit(1);
     }
+}
 
-    //write tasks to file
-    struct task* currTask = tasks->head;
-    while(currTask != NULL)
+/**********************************************************************************
+    ** Description: Turns following the imported file on or off.
+    ** Parameters: The followState, and the taskList to update
+**********************************************************************************/
+void toggleFollow(struct followState* follow, struct taskList* tasks)
+{
+    system("clear");
+
+    //only a single imported file can be followed
+    if(follow->path == NULL)
     {
-        fprintf(exportFile, "%d|%s|%d_%d_%d|%s\n", currTask->complete, currTask->name, currTask->dueDate.year, currTask->dueDate.month, currTask->dueDate.day, currTask->category);
-        currTask = currTask->next;
+        printf("|--------------------------------------------------\n|   Following is only available when tasks\n|   were imported from a single file.\n");
+        return;
+    }
+
+    if(follow->inotifyFd != -1)
+    {
+        stopFollow(follow);
+        printf("|--------------------------------------------------\n|   Stopped following '%s'.\n", follow->path);
+    }
+    else if(startFollow(follow, tasks) == 0)
+    {
+        printf("|--------------------------------------------------\n|   Following '%s'. Tasks added to\n|   it by other tools will appear here.\n", follow->path);
+    }
+    else
+    {
+        perror("Error following file");
     }
-    printf("|\n|   Tasks exported to %s!\n", buffer);
-    fclose(exportFile);
-    free(buffer);
 }
 
 int main(int argc, char *argv[])
@@ -668,38 +3117,70 @@ int main(int argc, char *argv[])
     //create taskList
     struct taskList tasks;
     tasks.head = NULL;
+    tasks.tail = NULL;
+    tasks.slices = NULL;
+    tasks.numSlices = 0;
+    tasks.sliceCapacity = 0;
     tasks.numTasks = 0;
     tasks.incompleteTasks = 0;
+    tasks.strings.blocks = NULL;
+    tasks.followedStrings.blocks = NULL;
+    tasks.heap = NULL;
+    tasks.heapSize = 0;
+    tasks.heapCapacity = 0;
+    tasks.weights = NULL;
+    tasks.numWeights = 0;
 
     //prompt user to import tasks or start fresh
     system("clear");
     FILE* importFile = promptImport(&buffer, bufferSize, 0);
+    char** importPaths = NULL;
+    int numImportPaths = 0;
+    struct followState follow;
+    memset(&follow, 0, sizeof(struct followState));
+    follow.inotifyFd = -1;
     
     //if file couldn't be opened, AND user didn't just hit enter to start fresh
     while(importFile == NULL && buffer[0] != '\0')
     {
+        //the input may be a list of files or a glob pattern instead of one file
+        numImportPaths = expandImportPaths(buffer, &importPaths);
+        if(numImportPaths > 0)
+        {
+            break;
+        }
+
         //keep reprompting user
         importFile = promptImport(&buffer, bufferSize, 1);
     }
 
+    //if importPaths is set, user is importing several files
     //if importFile is null here, user is starting fresh
     //otherwise, user is importing tasks
-    if(!importFile)
+    if(numImportPaths > 0)
+    {
+        importTaskFiles(&tasks, importPaths, numImportPaths);
+    }
+    else if(!importFile)
     {
         createTaskFromUser(&tasks);
     }
     else
     {
-        importTasks(&tasks, importFile);
+        //remember the file (and how much of it was read) so it can be followed
+        initFollow(&follow, buffer, importFile);
+        follow.offset = importTasks(&tasks, importFile);
+        recordFollowTail(&follow);
     }
 
     //main menu loop
     while(1)
     {
         //display main menu options
-        printf("|--------------------------------------------------\n|\n|   Task Manager: Home\n|\n|   1. View all tasks\n|   2. Mark a task as complete\n|   3. Create a new task\n|   4. Export your tasks to a file\n|\n|   Please type 1, 2, 3, or 4, and hit\n|   enter to do the corresponding action.\n|\n|   To exit, type 'exit' and hit enter.\n|\n|   : ");
+        printf("|--------------------------------------------------\n|\n|   Task Manager: Home\n|\n|   1. View all tasks\n|   2. Mark a task as complete\n|   3. Create a new task\n|   4. Export your tasks to a file\n|   5. Report on your tasks\n|   6. Follow the import file for changes\n|   7. View your next tasks\n|   8. Mark your next task as complete\n|   9. Prioritize a category\n|\n|   Please type 1 to 9, and hit\n|   enter to do the corresponding action.\n|\n|   To exit, type 'exit' and hit enter.\n|\n|   : ");
         
-        //get user input
+        //get user input, syncing the followed file while waiting
+        waitForInput(&follow, &tasks);
         size_t charsRead = getline(&buffer, &bufferSize, stdin);
         if(charsRead == -1)
         {
@@ -725,6 +3206,26 @@ int main(int argc, char *argv[])
         {
             exportTasks(&tasks);
         }
+        else if(strcmp(buffer, "5") == 0)
+        {
+            reportTasks(&tasks);
+        }
+        else if(strcmp(buffer, "6") == 0)
+        {
+            toggleFollow(&follow, &tasks);
+        }
+        else if(strcmp(buffer, "7") == 0)
+        {
+            showNextTasks(&tasks);
+        }
+        else if(strcmp(buffer, "8") == 0)
+        {
+            completeNextTask(&tasks);
+        }
+        else if(strcmp(buffer, "9") == 0)
+        {
+            prioritizeCategory(&tasks);
+        }
         else if(strcmp(buffer, "exit") == 0)
         {
             break;
@@ -738,6 +3239,8 @@ int main(int argc, char *argv[])
     //free dynamic memory
     freeTaskList(&tasks);
     free(buffer);
+    stopFollow(&follow);
+    free(follow.path);
 
     //send termination to python microservice
     kill(childPID, SIGTERM);